@@ -30,9 +30,14 @@
 #define __SYCL_IMPL_BUFFER_ALGORITHM__
 
 #include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_compensated.hpp>
+#include <sycl/helpers/sycl_device_properties.hpp>
+#include <sycl/helpers/sycl_future.hpp>
 #include <sycl/helpers/sycl_namegen.hpp>
 
 #include <cassert>
+#include <type_traits>
+#include <vector>
 
 namespace sycl {
 namespace impl {
@@ -51,7 +56,11 @@ struct sycl_algorithm_descriptor {
          nb_work_item;
   sycl_algorithm_descriptor() = default;
   sycl_algorithm_descriptor(size_t size_):
-    size(size_) {}
+    size(size_),
+    size_per_work_group(0),
+    size_per_work_item(0),
+    nb_work_group(0),
+    nb_work_item(0) {}
   sycl_algorithm_descriptor(size_t size_,
                        size_t size_per_work_group_,
                        size_t size_per_work_item_,
@@ -84,17 +93,12 @@ sycl_algorithm_descriptor compute_mapreduce_descriptor(cl::sycl::device device,
        local_mem_size
    *  - every work group do something
    */
-  size_t max_work_group =
-    device.get_info<cl::sycl::info::device::max_compute_units>();
+  const auto properties = sycl::helpers::get_device_properties(device);
+  size_t max_work_group = properties.max_compute_units;
 
-  const cl::sycl::id<3>max_work_item_sizes =
-    device.get_info<cl::sycl::info::device::max_work_item_sizes>();
-  const auto max_work_item = min(
-    device.get_info<cl::sycl::info::device::max_work_group_size>(),
-    max_work_item_sizes[0]);
+  const auto max_work_item = properties.max_work_item;
 
-  size_t local_mem_size =
-    device.get_info<cl::sycl::info::device::local_mem_size>();
+  size_t local_mem_size = properties.local_mem_size;
 
   size_t nb_work_item = min(max_work_item, local_mem_size / sizeofB);
 
@@ -139,26 +143,240 @@ sycl_algorithm_descriptor compute_mapreduce_descriptor(cl::sycl::device device,
     nb_work_item };
 }
 
+/*
+ * Combine the first nb_active values of sum with reduce, in a tree of
+ * log2(nb_active) steps executed by the work-items of the work-group.
+ * The tree itself keeps the order of sum, but the work-items fill sum with
+ * strided or vector-lane accumulations that interleave the elements, so
+ * buffer_mapreduce needs reduce to be associative and commutative.
+ * The result is left in sum[0].
+ */
+template <typename Group, typename LocalAccessor, typename Reduce>
+void work_group_combine(Group &grp, LocalAccessor sum, size_t nb_active,
+                        Reduce reduce) {
+  for (size_t offset = 1; offset < nb_active; offset *= 2) {
+    grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+      size_t local_id = id.get_local_id(0);
+      if (local_id % (2 * offset) == 0 && local_id + offset < nb_active) {
+        sum[local_id] = reduce(sum[local_id], sum[local_id + offset]);
+      }
+    });
+  }
+}
+
+/*
+ * Number of elements of type A read at once by the work-items of
+ * buffer_mapreduce, 1 if they are read one at a time
+ */
+template <typename A>
+struct mapreduce_vector_width {
+  static constexpr size_t value = 1;
+};
+
+template <>
+struct mapreduce_vector_width<float> {
+  static constexpr size_t value = 4;
+};
+
+template <>
+struct mapreduce_vector_width<int> {
+  static constexpr size_t value = 4;
+};
+
+template <>
+struct mapreduce_vector_width<char> {
+  static constexpr size_t value = 8;
+};
+
+/*
+ * Work of a work-item of buffer_mapreduce: map and reduce its elements of
+ * [group_begin, group_end), and store the result in sum[local_id].
+ * The work-items 0 to nb_active() - 1 have at least one element.
+ *
+ * The elements are read one at a time, with a stride of nb_work_item
+ */
+template <typename A, typename B, typename Enable = void>
+struct work_item_mapreduce {
+  static size_t nb_active(size_t nb_work_item, size_t group_begin,
+                          size_t group_end) {
+    using std::min;
+    return min(nb_work_item, group_end - group_begin);
+  }
+
+  template <typename Input, typename LocalAccessor, typename Map,
+            typename Reduce>
+  static void map_reduce(Input input, LocalAccessor sum, size_t local_id,
+                         size_t nb_work_item, size_t group_begin,
+                         size_t group_end, Map map, Reduce reduce) {
+    size_t local_pos = group_begin + local_id;
+    if (local_pos < group_end) {
+      //we peal the first iteration
+      B acc = map(local_pos, input[local_pos]);
+      for (size_t read = local_pos + nb_work_item;
+           read < group_end;
+           read += nb_work_item) {
+        acc = reduce(acc, map(read, input[read]));
+      }
+      sum[local_id] = acc;
+    }
+  }
+};
+
+/*
+ * The elements are read by vectors of W = mapreduce_vector_width<A>
+ * elements, aligned on W elements, with a stride of nb_work_item vectors.
+ * The unaligned elements at both ends of [group_begin, group_end) are read
+ * one at a time, the i-th ones of each end by the work-item i
+ */
+template <typename A, typename B>
+struct work_item_mapreduce<
+    A, B,
+    typename std::enable_if<(mapreduce_vector_width<A>::value > 1) &&
+                            std::is_default_constructible<B>::value>::type> {
+  static constexpr size_t W = mapreduce_vector_width<A>::value;
+
+  static size_t vector_begin(size_t group_begin, size_t group_end) {
+    using std::min;
+    return min(up_rounded_division(group_begin, W) * W, group_end);
+  }
+
+  static size_t vector_end(size_t group_begin, size_t group_end) {
+    using std::max;
+    return max(vector_begin(group_begin, group_end), group_end / W * W);
+  }
+
+  static size_t nb_active(size_t nb_work_item, size_t group_begin,
+                          size_t group_end) {
+    using std::max;
+    using std::min;
+    size_t vec_begin = vector_begin(group_begin, group_end);
+    size_t vec_end = vector_end(group_begin, group_end);
+    return min(nb_work_item,
+               max((vec_end - vec_begin) / W,
+                   max(vec_begin - group_begin, group_end - vec_end)));
+  }
+
+  template <typename Input, typename LocalAccessor, typename Map,
+            typename Reduce>
+  static void map_reduce(Input input, LocalAccessor sum, size_t local_id,
+                         size_t nb_work_item, size_t group_begin,
+                         size_t group_end, Map map, Reduce reduce) {
+    size_t vec_begin = vector_begin(group_begin, group_end);
+    size_t vec_end = vector_end(group_begin, group_end);
+    bool empty = true;
+    B acc;
+    auto accumulate = [&](size_t pos, A x) {
+      acc = empty ? map(pos, x) : reduce(acc, map(pos, x));
+      empty = false;
+    };
+
+    for (size_t chunk = vec_begin / W + local_id;
+         chunk < vec_end / W;
+         chunk += nb_work_item) {
+      cl::sycl::vec<A, W> v;
+      v.load(chunk, input.get_pointer());
+      A x[W];
+      v.store(0, cl::sycl::private_ptr<A>(x));
+      for (size_t i = 0; i < W; i++) {
+        accumulate(chunk * W + i, x[i]);
+      }
+    }
+    for (size_t read = group_begin + local_id;
+         read < vec_begin;
+         read += nb_work_item) {
+      accumulate(read, input[read]);
+    }
+    for (size_t read = vec_end + local_id;
+         read < group_end;
+         read += nb_work_item) {
+      accumulate(read, input[read]);
+    }
+
+    if (!empty) {
+      sum[local_id] = acc;
+    }
+  }
+};
+
+/*
+ * Final stage of the map reduce algorithms: reduce the d.nb_work_group
+ * partial results with init on the device, in a single work-group, and
+ * write the result to output[output_pos]. Returns the event of the kernel.
+ */
+template <typename ExecutionPolicy,
+          typename B,
+          typename Reduce,
+          typename OutputAlloc>
+cl::sycl::event buffer_reduce_partials(ExecutionPolicy &snp,
+                            cl::sycl::queue q,
+                            cl::sycl::buffer<B, 1> partial_buff,
+                            cl::sycl::buffer<B, 1, OutputAlloc> output_buff,
+                            B init,
+                            sycl_algorithm_descriptor d,
+                            Reduce reduce,
+                            size_t output_pos = 0) {
+  using std::min;
+
+  return q.submit([&] (cl::sycl::handler &cgh) {
+    size_t nb_work_item = min(d.nb_work_item, d.nb_work_group);
+    cl::sycl::range<1> rg { nb_work_item };
+    cl::sycl::range<1> ri { nb_work_item };
+    auto partial = partial_buff.template get_access
+      <cl::sycl::access::mode::read>(cgh);
+    auto output = output_buff.template get_access
+      <cl::sycl::access::mode::write>(cgh);
+    cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+      sum { cl::sycl::range<1>(nb_work_item), cgh };
+    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<1,
+        typename ExecutionPolicy::kernelName>>(rg, ri,
+                                               [=](cl::sycl::group<1> grp) {
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id = id.get_local_id(0);
+        B acc = partial[local_id];
+        for (size_t read = local_id + nb_work_item;
+             read < d.nb_work_group;
+             read += nb_work_item) {
+          acc = reduce(acc, partial[read]);
+        }
+        sum[local_id] = acc;
+      });
+      work_group_combine(grp, sum, nb_work_item, reduce);
+
+      output[output_pos] = reduce(init, sum[0]);
+    });
+  });
+}
+
 /*
  * MapReduce Algorithm applied on a buffer
  *
  * with map/reduce functions typed as follow
  * Map    : A -> B
  * Reduce : B -> B -> B
+ *
+ * The result is written to output_buff[output_pos] on the device, the
+ * returned event tracks the kernel writing it. The temporary buffers of the
+ * kernels are added to temporaries, which the caller keeps alive until they
+ * complete.
  */
 
 template <typename ExecutionPolicy,
           typename A,
           typename B,
           typename Reduce,
-          typename Map>
-B buffer_mapreduce(ExecutionPolicy &snp,
-                   cl::sycl::queue q,
-                   cl::sycl::buffer<A, 1> input_buff,
-                   B init, //map is not applied on init
-                   sycl_algorithm_descriptor d,
-                   Map map,
-                   Reduce reduce) {
+          typename Map,
+          typename OutputAlloc>
+cl::sycl::event buffer_mapreduce(ExecutionPolicy &snp,
+                                 cl::sycl::queue q,
+                                 cl::sycl::buffer<A, 1> input_buff,
+                                 cl::sycl::buffer<B, 1, OutputAlloc> output_buff,
+                                 B init, //map is not applied on init
+                                 sycl_algorithm_descriptor d,
+                                 Map map,
+                                 Reduce reduce,
+                                 sycl::helpers::sycl_temporaries &temporaries,
+                                 size_t output_pos = 0) {
 
   /*
    * 'map' is not applied on init
@@ -169,24 +387,28 @@ B buffer_mapreduce(ExecutionPolicy &snp,
   if ((d.nb_work_item == 0) || (d.nb_work_group == 0)) {
     auto read_input = input_buff.template get_access
       <cl::sycl::access::mode::read>();
+    auto write_output = output_buff.template get_access
+      <cl::sycl::access::mode::write>();
     B acc = init;
     for (size_t pos = 0; pos < d.size; pos++)
       acc = reduce(acc, map(pos, read_input[pos]));
 
-    return acc;
+    write_output[output_pos] = acc;
+    return cl::sycl::event();
   }
 
   using std::min;
   using std::max;
 
-  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { d.nb_work_group } };
+  cl::sycl::buffer<B, 1> partial_buff { cl::sycl::range<1> { d.nb_work_group } };
+  temporaries.keep(partial_buff);
 
   q.submit([&] (cl::sycl::handler &cgh) {
     cl::sycl::range<1> rg { d.nb_work_group * d.nb_work_item };
     cl::sycl::range<1> ri { d.nb_work_item };
     auto input = input_buff.template get_access
       <cl::sycl::access::mode::read>(cgh);
-    auto output = output_buff.template get_access
+    auto partial = partial_buff.template get_access
       <cl::sycl::access::mode::write>(cgh);
     cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
                        cl::sycl::access::target::local>
@@ -199,37 +421,94 @@ B buffer_mapreduce(ExecutionPolicy &snp,
       //assert(group_begin < group_end); //< as we properly selected the
                                        //  number of work_group
       grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
-        size_t local_id = id.get_local_id(0);
-        size_t local_pos = group_begin + local_id;
-        if (local_pos < group_end) {
-          //we peal the first iteration
-          B acc = map(local_pos, input[local_pos]);
-          for (size_t read = local_pos + d.nb_work_item;
-               read < group_end;
-               read += d.nb_work_item) {
-            acc = reduce(acc, map(read, input[read]));
-          }
-          sum[local_id] = acc;
-        }
+        work_item_mapreduce<A, B>::map_reduce(
+            input, sum, id.get_local_id(0), d.nb_work_item, group_begin,
+            group_end, map, reduce);
       });
-      B acc = sum[0];
-      for (size_t local_id = 1;
-           local_id < min(d.nb_work_item, group_end - group_begin);
-           local_id++)
-        acc = reduce(acc, sum[local_id]);
+      work_group_combine(grp, sum,
+                         work_item_mapreduce<A, B>::nb_active(
+                             d.nb_work_item, group_begin, group_end),
+                         reduce);
 
-      output[group_id] = acc;
+      partial[group_id] = sum[0];
     });
   });
+  return buffer_reduce_partials(snp, q, partial_buff, output_buff, init, d,
+                                reduce, output_pos);
+}
+
+/*
+ * MapReduce Algorithm applied on a buffer, returning the result on the host.
+ * Only the final value is read back from the device.
+ */
+template <typename ExecutionPolicy,
+          typename A,
+          typename B,
+          typename Reduce,
+          typename Map>
+B buffer_mapreduce(ExecutionPolicy &snp,
+                   cl::sycl::queue q,
+                   cl::sycl::buffer<A, 1> input_buff,
+                   B init, //map is not applied on init
+                   sycl_algorithm_descriptor d,
+                   Map map,
+                   Reduce reduce) {
+  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { 1 } };
+  sycl::helpers::sycl_temporaries temporaries;
+  buffer_mapreduce(snp, q, input_buff, output_buff, init, d, map, reduce,
+                   temporaries);
+
   auto read_output = output_buff.template get_access
     <cl::sycl::access::mode::read>();
+  return read_output[0];
+}
 
-  B acc = init;
-  for (size_t pos0 = 0; pos0 < d.nb_work_group; pos0++) {
-    acc = reduce(acc, read_output[pos0]);
-  }
-
-  return acc;
+/*
+ * Compensated MapReduce applied on a buffer, for sums of floating point
+ * values
+ *
+ * Map : A -> B
+ *
+ * Every work-item sums its elements with Kahan-Babuska additions, then the
+ * work-items and work-groups combine their compensated sums pairwise. The
+ * rounding error is added back to the sum on the device, and the result is
+ * written to output_buff[0]. The returned event tracks the kernel writing it,
+ * the temporary buffers are added to temporaries
+ */
+template <typename ExecutionPolicy,
+          typename A,
+          typename B,
+          typename Map>
+cl::sycl::event buffer_compensated_mapreduce(ExecutionPolicy &snp,
+                                             cl::sycl::queue q,
+                                             cl::sycl::buffer<A, 1> input_buff,
+                                             cl::sycl::buffer<B, 1> output_buff,
+                                             B init, //map is not applied on init
+                                             sycl_algorithm_descriptor d,
+                                             Map map,
+                                             sycl::helpers::sycl_temporaries
+                                                 &temporaries) {
+  using C = sycl::helpers::compensated_value<B>;
+
+  cl::sycl::buffer<C, 1> sum_buff { cl::sycl::range<1> { 1 } };
+  temporaries.keep(sum_buff);
+  buffer_mapreduce(snp, q, input_buff, sum_buff, C { init, B(0) }, d,
+                   [=](size_t pos, A x) { return C { map(pos, x), B(0) }; },
+                   [](C x, C y) {
+                     return sycl::helpers::compensated_add(x, y);
+                   },
+                   temporaries);
+
+  return q.submit([&] (cl::sycl::handler &cgh) {
+    auto sum = sum_buff.template get_access
+      <cl::sycl::access::mode::read>(cgh);
+    auto output = output_buff.template get_access
+      <cl::sycl::access::mode::write>(cgh);
+    cgh.single_task<cl::sycl::helpers::NameGen<2,
+        typename ExecutionPolicy::kernelName>>([=]() {
+      output[0] = sum[0].sum + sum[0].error;
+    });
+  });
 }
 
 /*
@@ -239,6 +518,8 @@ B buffer_mapreduce(ExecutionPolicy &snp,
  * Map : A1 -> A2 -> B
  * Reduce : B -> B -> B
  *
+ * The result is written to output_buff[0] on the device, the returned event
+ * tracks the kernel writing it
  */
 template <typename ExecutionPolicy,
           typename A1,
@@ -246,31 +527,35 @@ template <typename ExecutionPolicy,
           typename B,
           typename Reduce,
           typename Map>
-B buffer_map2reduce(ExecutionPolicy &snp,
-                    cl::sycl::queue q,
-                    cl::sycl::buffer<A1, 1> input_buff1,
-                    cl::sycl::buffer<A2, 1> input_buff2,
-                    B init, //map is not applied on init
-                    sycl_algorithm_descriptor d,
-                    Map map,
-                    Reduce reduce) {
+cl::sycl::event buffer_map2reduce(ExecutionPolicy &snp,
+                                  cl::sycl::queue q,
+                                  cl::sycl::buffer<A1, 1> input_buff1,
+                                  cl::sycl::buffer<A2, 1> input_buff2,
+                                  cl::sycl::buffer<B, 1> output_buff,
+                                  B init, //map is not applied on init
+                                  sycl_algorithm_descriptor d,
+                                  Map map,
+                                  Reduce reduce) {
 
   if ((d.nb_work_item == 0) || (d.nb_work_group == 0)) {
     auto read_input1 = input_buff1.template get_access
       <cl::sycl::access::mode::read>();
     auto read_input2 = input_buff2.template get_access
       <cl::sycl::access::mode::read>();
+    auto write_output = output_buff.template get_access
+      <cl::sycl::access::mode::write>();
     B acc = init;
     for (size_t pos = 0; pos < d.size; pos++)
       acc = reduce(acc, map(pos, read_input1[pos], read_input2[pos]));
 
-    return acc;
+    write_output[0] = acc;
+    return cl::sycl::event();
   }
 
   using std::min;
   using std::max;
 
-  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { d.nb_work_group } };
+  cl::sycl::buffer<B, 1> partial_buff { cl::sycl::range<1> { d.nb_work_group } };
 
   q.submit([&] (cl::sycl::handler &cgh) {
     cl::sycl::nd_range<1> rng
@@ -280,7 +565,7 @@ B buffer_map2reduce(ExecutionPolicy &snp,
       <cl::sycl::access::mode::read>(cgh);
     auto input2  = input_buff2.template get_access
       <cl::sycl::access::mode::read>(cgh);
-    auto output = output_buff.template get_access
+    auto partial = partial_buff.template get_access
       <cl::sycl::access::mode::write>(cgh);
     cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
                        cl::sycl::access::target::local>
@@ -302,28 +587,47 @@ B buffer_map2reduce(ExecutionPolicy &snp,
           for (size_t read = local_pos + d.nb_work_item;
                read < group_end;
                read += d.nb_work_item) {
-            acc = reduce(acc, map(read, input1[read], input2[local_pos]));
+            acc = reduce(acc, map(read, input1[read], input2[read]));
           }
           sum[local_id] = acc;
         }
       });
-      B acc = sum[0];
-      for (size_t local_id = 1;
-           local_id < min(d.nb_work_item, group_end - group_begin);
-           local_id++)
-        acc = reduce(acc, sum[local_id]);
+      work_group_combine(grp, sum,
+                         min(d.nb_work_item, group_end - group_begin),
+                         reduce);
 
-      output[group_id] = acc;
+      partial[group_id] = sum[0];
     });
   });
-  auto read_output  = output_buff.template get_access
-    <cl::sycl::access::mode::read>();
+  return buffer_reduce_partials(snp, q, partial_buff, output_buff, init, d,
+                                reduce);
+}
 
-  B acc = init;
-  for (size_t pos0 = 0; pos0 < d.nb_work_group; pos0++)
-    acc = reduce(acc, read_output[pos0]);
+/*
+ * Map2Reduce on a buffer, returning the result on the host.
+ * Only the final value is read back from the device.
+ */
+template <typename ExecutionPolicy,
+          typename A1,
+          typename A2,
+          typename B,
+          typename Reduce,
+          typename Map>
+B buffer_map2reduce(ExecutionPolicy &snp,
+                    cl::sycl::queue q,
+                    cl::sycl::buffer<A1, 1> input_buff1,
+                    cl::sycl::buffer<A2, 1> input_buff2,
+                    B init, //map is not applied on init
+                    sycl_algorithm_descriptor d,
+                    Map map,
+                    Reduce reduce) {
+  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { 1 } };
+  buffer_map2reduce(snp, q, input_buff1, input_buff2, output_buff, init, d,
+                    map, reduce);
 
-  return acc;
+  auto read_output = output_buff.template get_access
+    <cl::sycl::access::mode::read>();
+  return read_output[0];
 }
 
 
@@ -335,19 +639,15 @@ sycl_algorithm_descriptor compute_mapscan_descriptor(cl::sycl::device device,
   using std::max;
   if (size == 0)
     return sycl_algorithm_descriptor {};
-  size_t local_mem_size =
-    device.get_info<cl::sycl::info::device::local_mem_size>();
+  const auto properties = sycl::helpers::get_device_properties(device);
+  size_t local_mem_size = properties.local_mem_size;
   size_t size_per_work_group = min(size, local_mem_size / sizeofB);
   if (size_per_work_group <= 0)
     return sycl_algorithm_descriptor { size };
 
   size_t nb_work_group = up_rounded_division(size, size_per_work_group);
 
-  const cl::sycl::id<3> max_work_item_sizes =
-    device.get_info<cl::sycl::info::device::max_work_item_sizes>();
-  const auto max_work_item = min(
-    device.get_info<cl::sycl::info::device::max_work_group_size>(),
-    max_work_item_sizes[0]);
+  const auto max_work_item = properties.max_work_item;
   size_t nb_work_item = min(max_work_item, size_per_work_group);
   size_t size_per_work_item =
     up_rounded_division(size_per_work_group, nb_work_item);
@@ -360,23 +660,225 @@ sycl_algorithm_descriptor compute_mapscan_descriptor(cl::sycl::device device,
 }
 
 
-template <class ExecutionPolicy, class A, class B, class Reduce, class Map>
-void buffer_mapscan(ExecutionPolicy &snp,
-                    cl::sycl::queue q,
-                    cl::sycl::buffer<A, 1> input_buffer,
-                    cl::sycl::buffer<B, 1> output_buffer,
-                    B init,
-                    sycl_algorithm_descriptor d,
-                    Map map,
-                    Reduce red) {
+/*
+ * Local stage of the scan algorithms: map the elements [group_begin,
+ * group_end) of input into scratch and scan them with red, so that
+ * scratch[i] holds the reduction of the i + 1 first elements of the
+ * work-group
+ */
+template <class B, class Group, class Input, class LocalAccessor,
+          class Reduce, class Map>
+void work_group_scan(Group &grp, Input input, LocalAccessor scratch,
+                     sycl_algorithm_descriptor d, size_t group_begin,
+                     size_t group_end, Map map, Reduce red) {
+  using std::min;
+  size_t local_size = group_end - group_begin;
+
+  // Step 0:
+  // each work_item copy a piece of data
+  // map is applied during the process
+  grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+    size_t local_id  = id.get_local_id(0);
+    // gpos: position in the global vector
+    // lpos: position in the local vector
+    for (size_t gpos = group_begin + local_id, lpos = local_id;
+        gpos < group_end;
+        gpos += d.nb_work_item, lpos += d.nb_work_item) {
+      scratch[lpos] = map(input[gpos]);
+    }
+  });
+
+  // Step 1:
+  // each work_item scan a piece of data
+  grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+    size_t local_id  = id.get_local_id(0);
+    size_t local_pos = local_id * d.size_per_work_item;
+    size_t local_end = min((local_id+1) * d.size_per_work_item, local_size);
+    if (local_pos < local_end) {
+      B acc = scratch[local_pos];
+      local_pos++;
+      for (; local_pos < local_end; local_pos++) {
+        acc = red(acc, scratch[local_pos]);
+        scratch[local_pos] = acc;
+      }
+    }
+  });
+
+  // Step 2:
+  {
+    // scan on every last item
+    size_t local_pos = d.size_per_work_item - 1;
+    if (local_pos < local_size)
+    {
+      B acc = scratch[local_pos];
+      local_pos += d.size_per_work_item;
+      for (; local_pos < local_size; local_pos += d.size_per_work_item) {
+        acc = red(acc, scratch[local_pos]);
+        scratch[local_pos] = acc;
+      }
+    }
+  }
+
+  // Step 3:
+  // (except for group = 0) add the last element of the previous block
+  grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+    size_t local_id  = id.get_local_id(0);
+    if (local_id > 0) {
+      size_t local_pos = local_id * d.size_per_work_item;
+      size_t local_end = min((local_id+1) * d.size_per_work_item - 1,
+                             local_size);
+      if (local_pos < local_end) {
+        B acc = scratch[local_pos - 1];
+        for (; local_pos < local_end; local_pos++) {
+          scratch[local_pos] = red(acc, scratch[local_pos]);
+        }
+      }
+    }
+  });
+}
+
+/*
+ * Inclusive scan of the totals of the work-groups of a scan, on the device.
+ * The totals are scanned by blocks, the totals of the blocks making the next
+ * level, until a single block is left. Every level then adds the scan of the
+ * level above, so the work grows with the number of totals but the host only
+ * loops on the few levels.
+ */
+template <class ExecutionPolicy, class B, class Reduce>
+void buffer_scan_totals(ExecutionPolicy &snp,
+                        cl::sycl::queue q,
+                        cl::sycl::buffer<B, 1> totals,
+                        Reduce red) {
+  using std::min;
+  auto device = q.get_device();
+
+  std::vector<cl::sycl::buffer<B, 1>> levels { totals };
+  std::vector<sycl_algorithm_descriptor> descriptors;
+
+  // up-sweep: scan every level by blocks
+  for (;;) {
+    auto level = levels.back();
+    size_t size = level.get_count();
+    auto d = compute_mapscan_descriptor(device, size, sizeof(B));
+    if (d.nb_work_group == 0 || (size > 1 && d.nb_work_group >= size)) {
+      // the local memory holds less than two totals, so blocks would not
+      // make the level any smaller: scan it with a single work-item
+      q.submit([&] (cl::sycl::handler &cgh) {
+        auto data = level.template get_access
+          <cl::sycl::access::mode::read_write>(cgh);
+        cgh.single_task<cl::sycl::helpers::NameGen<9,
+            typename ExecutionPolicy::kernelName>>([=]() {
+          B acc = data[0];
+          for (size_t pos = 1; pos < size; pos++) {
+            acc = red(acc, data[pos]);
+            data[pos] = acc;
+          }
+        });
+      });
+      break;
+    }
+    descriptors.push_back(d);
+
+    cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
+    cl::sycl::range<1> rng_wi {d.nb_work_item};
+    auto next = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
+
+    q.submit([&] (cl::sycl::handler &cgh) {
+      auto data = level.template get_access
+        <cl::sycl::access::mode::read_write>(cgh);
+      auto block_totals = next.template get_access
+        <cl::sycl::access::mode::write>(cgh);
+      cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+        scratch { cl::sycl::range<1> { d.size_per_work_group }, cgh };
+
+      cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<4,
+          typename ExecutionPolicy::kernelName>>(rng_wg, rng_wi,
+                                                 [=](cl::sycl::group<1> grp) {
+        size_t group_id = grp.get_id(0);
+        size_t group_begin = group_id * d.size_per_work_group;
+        size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
+
+        work_group_scan<B>(grp, data, scratch, d, group_begin, group_end,
+                           [](B x) { return x; }, red);
+
+        grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+          size_t local_id = id.get_local_id(0);
+          for (size_t gpos = group_begin + local_id, lpos = local_id;
+              gpos < group_end;
+              gpos+=d.nb_work_item, lpos+=d.nb_work_item) {
+            data[gpos] = scratch[lpos];
+          }
+        });
+        block_totals[group_id] = scratch[group_end - group_begin - 1];
+      });
+    });
+
+    if (d.nb_work_group <= 1)
+      break;
+    levels.push_back(next);
+  }
+
+  // down-sweep: add the scan of the level above to every block but the first
+  for (size_t i = levels.size() - 1; i > 0; i--) {
+    auto lower = levels[i - 1];
+    auto upper = levels[i];
+    auto d = descriptors[i - 1];
+    cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
+    cl::sycl::range<1> rng_wi {d.nb_work_item};
+
+    q.submit([&] (cl::sycl::handler &cgh) {
+      auto data = lower.template get_access
+        <cl::sycl::access::mode::read_write>(cgh);
+      auto carries = upper.template get_access
+        <cl::sycl::access::mode::read>(cgh);
+      cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<5,
+          typename ExecutionPolicy::kernelName>>(rng_wg, rng_wi,
+                                                 [=](cl::sycl::group<1> grp) {
+        size_t group_id = grp.get_id(0);
+        if (group_id == 0)
+          return;
+        B acc = carries[group_id - 1];
+        size_t group_begin = group_id * d.size_per_work_group;
+        size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
+
+        grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+          size_t local_id = id.get_local_id(0);
+          for (size_t gpos = group_begin + local_id;
+               gpos < group_end;
+               gpos += d.nb_work_item) {
+            data[gpos] = red(acc, data[gpos]);
+          }
+        });
+      });
+    });
+  }
+}
+
+/*
+ * Scan in three passes: a local scan of every work-group, a scan of the
+ * totals of the work-groups on the device, and the propagation of this scan
+ * on the local scans. This is the default scan of buffer_mapscan.
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map,
+          class InputAlloc, class OutputAlloc>
+void buffer_mapscan_three_pass(ExecutionPolicy &snp,
+                               cl::sycl::queue q,
+                               cl::sycl::buffer<A, 1, InputAlloc> input_buffer,
+                               cl::sycl::buffer<B, 1, OutputAlloc> output_buffer,
+                               B init,
+                               sycl_algorithm_descriptor d,
+                               Map map,
+                               Reduce red,
+                               size_t input_pos,
+                               size_t output_pos) {
     //map is not applied on init
 
   using std::min;
   using std::max;
 
   //WARNING: nb_work_group is not bounded by max_compute_units
-  auto scan = sycl::helpers::make_temp_buffer<B>( d.nb_work_group );
-  //cl::sycl::buffer<B, 1> scan = { cl::sycl::range<1> { d.nb_work_group } };
+  auto totals = sycl::helpers::make_temp_buffer<B>( d.nb_work_group );
   cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
   cl::sycl::range<1> rng_wi {d.nb_work_item};
 
@@ -385,6 +887,8 @@ void buffer_mapscan(ExecutionPolicy &snp,
       input_buffer.template get_access<cl::sycl::access::mode::read>(cgh);
     auto output =
       output_buffer.template get_access<cl::sycl::access::mode::write>(cgh);
+    auto write_totals =
+      totals.template get_access<cl::sycl::access::mode::write>(cgh);
 
     cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
                        cl::sycl::access::target::local>
@@ -396,69 +900,9 @@ void buffer_mapscan(ExecutionPolicy &snp,
       size_t group_id = grp.get_id(0);
       size_t group_begin = group_id * d.size_per_work_group;
       size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
-      size_t local_size = group_end - group_begin;
-
-      // Step 0:
-      // each work_item copy a piece of data
-      // map is applied during the process
-      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
-        size_t local_id  = id.get_local_id(0);
-        // gpos: position in the global vector
-        // lpos: position in the local vector
-        for (size_t gpos = group_begin + local_id, lpos = local_id;
-            gpos < group_end;
-            gpos += d.nb_work_item, lpos += d.nb_work_item) {
-          scratch[lpos] = map(input[gpos]);
-        }
-      });
-
-      // Step 1:
-      // each work_item scan a piece of data
-      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
-        size_t local_id  = id.get_local_id(0);
-        size_t local_pos = local_id * d.size_per_work_item;
-        size_t local_end = min((local_id+1) * d.size_per_work_item, local_size);
-        if (local_pos < local_end) {
-          B acc = scratch[local_pos];
-          local_pos++;
-          for (; local_pos < local_end; local_pos++) {
-            acc = red(acc, scratch[local_pos]);
-            scratch[local_pos] = acc;
-          }
-        }
-      });
-
-      // Step 2:
-      {
-        // scan on every last item
-        size_t local_pos = d.size_per_work_item - 1;
-        if (local_pos < local_size)
-        {
-          B acc = scratch[local_pos];
-          local_pos += d.size_per_work_item;
-          for (; local_pos < local_size; local_pos += d.size_per_work_item) {
-            acc = red(acc, scratch[local_pos]);
-            scratch[local_pos] = acc;
-          }
-        }
-      }
 
-      // Step 3:
-      // (except for group = 0) add the last element of the previous block
-      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
-        size_t local_id  = id.get_local_id(0);
-        if (local_id > 0) {
-          size_t local_pos = local_id * d.size_per_work_item;
-          size_t local_end = min((local_id+1) * d.size_per_work_item - 1,
-                                 local_size);
-          if (local_pos < local_end) {
-            B acc = scratch[local_pos - 1];
-            for (; local_pos < local_end; local_pos++) {
-              scratch[local_pos] = red(acc, scratch[local_pos]);
-            }
-          }
-        }
-      });
+      work_group_scan<B>(grp, input, scratch, d, input_pos + group_begin,
+                         input_pos + group_end, map, red);
 
       // Step 4:
       // each work_item copy a piece of data
@@ -468,40 +912,29 @@ void buffer_mapscan(ExecutionPolicy &snp,
         for (size_t gpos = group_begin + local_id, lpos = local_id;
             gpos < group_end;
             gpos+=d.nb_work_item, lpos+=d.nb_work_item) {
-          output[gpos] = scratch[lpos];
+          output[output_pos + gpos] = scratch[lpos];
         }
       });
+      write_totals[group_id] = scratch[group_end - group_begin - 1];
 
     });
   });
 
-  // STEP II: global scan
-  {
-    auto buff  = output_buffer.template get_access
-      <cl::sycl::access::mode::read_write>();
-    auto write_scan  = scan.template get_access
-      <cl::sycl::access::mode::write>();
-    B acc = init;
-    for (size_t global_pos = d.size_per_work_group - 1, local_pos = 0;
-        local_pos < d.nb_work_group - 1;
-        local_pos++, global_pos += d.size_per_work_group) {
-      write_scan[local_pos] = acc;
-      acc = red(acc, buff[global_pos]);
-    }
-    write_scan[d.nb_work_group - 1] = acc;
-  }
+  // STEP II: global scan of the totals, on the device
+  if (d.nb_work_group > 1)
+    buffer_scan_totals(snp, q, totals, red);
 
 
   // STEP III: propagate global scan on local scans
   q.submit([&] (cl::sycl::handler &cgh) {
     auto buff = output_buffer.template get_access
       <cl::sycl::access::mode::read_write>(cgh);
-    auto read_scan = scan.template get_access
+    auto read_totals = totals.template get_access
       <cl::sycl::access::mode::read>(cgh);
     cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<1, typename ExecutionPolicy::kernelName>>(rng_wg, rng_wi,
                                           [=](cl::sycl::group<1> grp) {
       size_t group_id = grp.get_id(0);
-      B acc = read_scan[group_id];
+      B acc = (group_id == 0) ? init : red(init, read_totals[group_id - 1]);
       //assert(group_id < d.nb_work_group);
       size_t group_begin = group_id * d.size_per_work_group;
       size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
@@ -515,7 +948,7 @@ void buffer_mapscan(ExecutionPolicy &snp,
         for (size_t gpos = group_begin + local_id;
              gpos < group_end;
              gpos += d.nb_work_item) {
-          buff[gpos] = red(acc, buff[gpos]);
+          buff[output_pos + gpos] = red(acc, buff[output_pos + gpos]);
         }
       });
     });
@@ -525,6 +958,228 @@ void buffer_mapscan(ExecutionPolicy &snp,
   return;
 }
 
+/*
+ * Status of a work-group in the decoupled look-back of buffer_mapscan
+ */
+enum scan_status : int {
+  scan_status_invalid = 0,    // nothing published yet
+  scan_status_aggregate = 1,  // the total of the work-group is published
+  scan_status_prefix = 2      // the inclusive prefix is published
+};
+
+/*
+ * Single-pass scan with decoupled look-back, used when SYCL_PSTL_SCAN_LOOKBACK
+ * is defined
+ *
+ * Every work-group takes a ticket from an atomic counter, which gives the
+ * part of the input it scans. Tickets are taken in the order in which the
+ * work-groups start, so a work-group only waits for work-groups that are
+ * already running. After its local scan, a work-group publishes its total,
+ * then walks back over its predecessors, combining their totals until it
+ * finds one that has published its inclusive prefix. It then publishes its
+ * own inclusive prefix and writes its part of the output. The ticket and the
+ * look-back are done by the first work-item of the work-group, which
+ * broadcasts them through local memory.
+ *
+ * The status of the work-groups and the ticket counter are atomic ints; the
+ * totals and prefixes are written before their status, separated by a memory
+ * fence. SYCL 1.2.1 guarantees neither forward progress between work-groups
+ * nor the visibility of these writes to other work-groups, so this path is
+ * only correct on backends that provide both, such as the host device and
+ * CPU OpenCL implementations running work-groups on their own threads. On
+ * other devices it can hang or produce a wrong scan.
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map,
+          class InputAlloc, class OutputAlloc>
+void buffer_mapscan_lookback(ExecutionPolicy &snp,
+                             cl::sycl::queue q,
+                             cl::sycl::buffer<A, 1, InputAlloc> input_buffer,
+                             cl::sycl::buffer<B, 1, OutputAlloc> output_buffer,
+                             B init,
+                             sycl_algorithm_descriptor d,
+                             Map map,
+                             Reduce red,
+                             size_t input_pos,
+                             size_t output_pos) {
+  using std::min;
+
+  cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
+  cl::sycl::range<1> rng_wi {d.nb_work_item};
+
+  // status of every work-group, followed by the ticket counter
+  std::vector<int> zeros(d.nb_work_group + 1, scan_status_invalid);
+  cl::sycl::buffer<int, 1> status_buffer { zeros.begin(), zeros.end() };
+  auto aggregate_buffer = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
+  auto prefix_buffer = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
+
+  q.submit([&] (cl::sycl::handler &cgh) {
+    auto input =
+      input_buffer.template get_access<cl::sycl::access::mode::read>(cgh);
+    auto output =
+      output_buffer.template get_access<cl::sycl::access::mode::write>(cgh);
+    auto status =
+      status_buffer.template get_access<cl::sycl::access::mode::atomic>(cgh);
+    auto aggregate = aggregate_buffer.template get_access
+      <cl::sycl::access::mode::read_write>(cgh);
+    auto prefix = prefix_buffer.template get_access
+      <cl::sycl::access::mode::read_write>(cgh);
+
+    cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+      scratch { cl::sycl::range<1> { d.size_per_work_group }, cgh };
+    // ticket and carry of the work-group, broadcast by its first work-item
+    cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+      ticket { cl::sycl::range<1> { 1 }, cgh };
+    cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+      carry { cl::sycl::range<1> { 1 }, cgh };
+
+    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<0,
+        typename ExecutionPolicy::kernelName>>(rng_wg, rng_wi,
+                                               [=](cl::sycl::group<1> grp) {
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        if (id.get_local_id(0) == 0) {
+          ticket[0] = status[d.nb_work_group].fetch_add(1);
+        }
+      });
+
+      size_t group_id = ticket[0];
+      size_t group_begin = group_id * d.size_per_work_group;
+      size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
+
+      work_group_scan<B>(grp, input, scratch, d, input_pos + group_begin,
+                         input_pos + group_end, map, red);
+
+      // Look-back: reduction of the totals of all the previous work-groups
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        if (id.get_local_id(0) != 0)
+          return;
+        B total = scratch[group_end - group_begin - 1];
+        if (group_id == 0) {
+          prefix[0] = total;
+          grp.mem_fence();
+          status[0].store(scan_status_prefix);
+          carry[0] = init;
+          return;
+        }
+        aggregate[group_id] = total;
+        grp.mem_fence();
+        status[group_id].store(scan_status_aggregate);
+
+        size_t pred = group_id - 1;
+        int pred_status = status[pred].load();
+        while (pred_status == scan_status_invalid) {
+          pred_status = status[pred].load();
+        }
+        grp.mem_fence();
+        B exclusive = (pred_status == scan_status_prefix) ? prefix[pred]
+                                                          : aggregate[pred];
+        while (pred_status != scan_status_prefix) {
+          pred--;
+          pred_status = status[pred].load();
+          while (pred_status == scan_status_invalid) {
+            pred_status = status[pred].load();
+          }
+          grp.mem_fence();
+          exclusive = red((pred_status == scan_status_prefix) ? prefix[pred]
+                                                              : aggregate[pred],
+                          exclusive);
+        }
+
+        prefix[group_id] = red(exclusive, total);
+        grp.mem_fence();
+        status[group_id].store(scan_status_prefix);
+        carry[0] = red(init, exclusive);
+      });
+
+      // Step 4:
+      // each work_item adds the carry and copies a piece of data
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id = id.get_local_id(0);
+        B acc = carry[0];
+        // lpos: position in the local vector
+        for (size_t gpos = group_begin + local_id, lpos = local_id;
+            gpos < group_end;
+            gpos+=d.nb_work_item, lpos+=d.nb_work_item) {
+          output[output_pos + gpos] = red(acc, scratch[lpos]);
+        }
+      });
+    });
+  });
+}
+
+/*
+ * Scan by a single work-item, for the elements too large for the local
+ * memory of the device to hold one of them
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map,
+          class InputAlloc, class OutputAlloc>
+void buffer_mapscan_single_task(ExecutionPolicy &snp,
+                                cl::sycl::queue q,
+                                cl::sycl::buffer<A, 1, InputAlloc> input_buffer,
+                                cl::sycl::buffer<B, 1, OutputAlloc>
+                                    output_buffer,
+                                B init,
+                                sycl_algorithm_descriptor d,
+                                Map map,
+                                Reduce red,
+                                size_t input_pos,
+                                size_t output_pos) {
+    //map is not applied on init
+  q.submit([&] (cl::sycl::handler &cgh) {
+    auto input =
+      input_buffer.template get_access<cl::sycl::access::mode::read>(cgh);
+    auto output =
+      output_buffer.template get_access<cl::sycl::access::mode::write>(cgh);
+    cgh.single_task<cl::sycl::helpers::NameGen<8,
+        typename ExecutionPolicy::kernelName>>([=]() {
+      B acc = init;
+      for (size_t pos = 0; pos < d.size; pos++) {
+        acc = red(acc, map(input[input_pos + pos]));
+        output[output_pos + pos] = acc;
+      }
+    });
+  });
+}
+
+/*
+ * Scan of the elements of input_buffer transformed by map, written to
+ * output_buffer. The d.size elements scanned start at input_pos in
+ * input_buffer and are written from output_pos in output_buffer.
+ *
+ * The three-pass scan is used unless SYCL_PSTL_SCAN_LOOKBACK is defined, see
+ * buffer_mapscan_lookback for the devices the single-pass scan needs.
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map,
+          class InputAlloc, class OutputAlloc>
+void buffer_mapscan(ExecutionPolicy &snp,
+                    cl::sycl::queue q,
+                    cl::sycl::buffer<A, 1, InputAlloc> input_buffer,
+                    cl::sycl::buffer<B, 1, OutputAlloc> output_buffer,
+                    B init,
+                    sycl_algorithm_descriptor d,
+                    Map map,
+                    Reduce red,
+                    size_t input_pos = 0,
+                    size_t output_pos = 0) {
+    //map is not applied on init
+  if (d.nb_work_group == 0) {
+    if (d.size > 0)
+      buffer_mapscan_single_task(snp, q, input_buffer, output_buffer, init, d,
+                                 map, red, input_pos, output_pos);
+    return;
+  }
+
+#ifdef SYCL_PSTL_SCAN_LOOKBACK
+  buffer_mapscan_lookback(snp, q, input_buffer, output_buffer, init, d, map,
+                          red, input_pos, output_pos);
+#else
+  buffer_mapscan_three_pass(snp, q, input_buffer, output_buffer, init, d, map,
+                            red, input_pos, output_pos);
+#endif
+}
+
 template <class BaseKernelName, class InT1, class InT2, class OutT, class IndexT,
           class BinaryOperation1, class BinaryOperation2>
 OutT inner_product_sequential_sycl(cl::sycl::queue q, cl::sycl::buffer<InT1, 1> input_buff1,
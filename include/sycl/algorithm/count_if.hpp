@@ -36,6 +36,7 @@
 // SYCL helpers header
 #include <sycl/helpers/sycl_buffers.hpp>
 #include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_future.hpp>
 #include <sycl/algorithm/algorithm_composite_patterns.hpp>
 #include <sycl/algorithm/buffer_algorithms.hpp>
 
@@ -44,27 +45,30 @@ namespace impl {
 
 #ifdef SYCL_PSTL_USE_OLD_ALGO
 
-/* count_if.
-* @brief Returns the count_if of one vector across the range [first,
-* last) by applying Function p. Implementation of the command group
-* that submits a count_if kernel.
+/* count_if_async.
+* @brief Starts the count_if of one vector across the range [first,
+* last) by applying Function p, and returns a handle on its result.
+* Implementation of the command group that submits a count_if kernel.
 */
 template <class ExecutionPolicy, class InputIterator, class UnaryOperation,
           class BinaryOperation>
-typename std::iterator_traits<InputIterator>::difference_type count_if(
-    ExecutionPolicy& exec, InputIterator first, InputIterator last,
-    UnaryOperation unary_op, BinaryOperation binary_op) {
+sycl::helpers::sycl_future<
+    typename std::iterator_traits<InputIterator>::difference_type>
+count_if_async(ExecutionPolicy& exec, InputIterator first, InputIterator last,
+               UnaryOperation unary_op, BinaryOperation binary_op) {
+  typedef typename std::iterator_traits<InputIterator>::difference_type
+      difference_type;
   cl::sycl::queue q(exec.get_queue());
   auto vectorSize = sycl::helpers::distance(first, last);
-  typename std::iterator_traits<InputIterator>::difference_type ret = 0;
 
   if (vectorSize < 1) {
-    return ret;
+    return sycl::helpers::sycl_future<difference_type>(0);
   }
 
   auto device = q.get_device();
   auto bufI = sycl::helpers::make_const_buffer(first, last);
   cl::sycl::buffer<int, 1> bufR((cl::sycl::range<1>(vectorSize)));
+  cl::sycl::buffer<difference_type, 1> bufC { cl::sycl::range<1> { 1 } };
   auto length = vectorSize;
   auto ndRange = exec.calculateNdRange(vectorSize);
   const auto local = ndRange.get_local_range()[0];
@@ -98,23 +102,48 @@ typename std::iterator_traits<InputIterator>::difference_type count_if(
                                     ndRange.get_local_range()};
     passes++;
   } while (length > 1);
-  q.wait_and_throw();
-  auto hr = bufR.template get_access<cl::sycl::access::mode::read>();
-  return hr[0];
+
+  auto event = q.submit([&](cl::sycl::handler& h) {
+    auto aR = bufR.template get_access<cl::sycl::access::mode::read>(h);
+    auto aC = bufC.template get_access<cl::sycl::access::mode::write>(h);
+    h.single_task<cl::sycl::helpers::NameGen<
+        11, typename ExecutionPolicy::kernelName>>(
+        [aR, aC]() { aC[0] = aR[0]; });
+  });
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(bufI);
+  temporaries.keep(bufR);
+  return sycl::helpers::sycl_future<difference_type>(bufC, event,
+                                                     temporaries.share());
+}
+
+/* count_if.
+ * Waits for the result of count_if_async.
+ */
+template <class ExecutionPolicy, class InputIterator, class UnaryOperation,
+          class BinaryOperation>
+typename std::iterator_traits<InputIterator>::difference_type count_if(
+    ExecutionPolicy& exec, InputIterator first, InputIterator last,
+    UnaryOperation unary_op, BinaryOperation binary_op) {
+  return sycl::impl::count_if_async(exec, first, last, unary_op, binary_op)
+      .get();
 }
 
 #else
 
 template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
           typename BinaryOperation>
-typename std::iterator_traits<InputIt>::difference_type count_if(
-    ExecutionPolicy& snp, InputIt b, InputIt e,
-    UnaryOperation unary_op, BinaryOperation binary_op) {
-
+sycl::helpers::sycl_future<
+    typename std::iterator_traits<InputIt>::difference_type>
+count_if_async(ExecutionPolicy& snp, InputIt b, InputIt e,
+               UnaryOperation unary_op, BinaryOperation binary_op) {
+  using difference_type =
+      typename std::iterator_traits<InputIt>::difference_type;
 
   auto q = snp.get_queue();
   auto size = sycl::helpers::distance(b, e);
-  if(size <= 0) return 0;
+  if(size <= 0) return sycl::helpers::sycl_future<difference_type>(0);
 
   auto device = q.get_device();
   using value_type = typename std::iterator_traits<InputIt>::value_type;
@@ -123,13 +152,27 @@ typename std::iterator_traits<InputIt>::difference_type count_if(
   auto d = compute_mapreduce_descriptor(device, size, sizeof(size_t));
 
   auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  cl::sycl::buffer<difference_type, 1> output_buff { cl::sycl::range<1> { 1 } };
 
   auto map = [=](size_t pos, value_type x) {
     return (unary_op(x)) ? 1 : 0;
   };
 
-  return buffer_mapreduce( snp, q, input_buff, 0, d, map, binary_op );
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_mapreduce( snp, q, input_buff, output_buff,
+                                 difference_type(0), d, map, binary_op,
+                                 temporaries );
+  return sycl::helpers::sycl_future<difference_type>(
+      output_buff, event, temporaries.share());
+}
 
+template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
+          typename BinaryOperation>
+typename std::iterator_traits<InputIt>::difference_type count_if(
+    ExecutionPolicy& snp, InputIt b, InputIt e,
+    UnaryOperation unary_op, BinaryOperation binary_op) {
+  return sycl::impl::count_if_async(snp, b, e, unary_op, binary_op).get();
 }
 #endif
 
@@ -32,6 +32,7 @@
 #include <sycl/helpers/sycl_buffers.hpp>
 #include <sycl/helpers/sycl_namegen.hpp>
 #include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/mapscan.hpp>
 
 namespace sycl {
 namespace impl {
@@ -46,7 +47,7 @@ template <class ExecutionPolicy, class InputIterator, class OutputIterator,
           class ElemT, class BinaryOperation>
 OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
                               InputIterator e, OutputIterator o, ElemT init,
-                              BinaryOperation bop) {
+                              BinaryOperation bop, std::false_type) {
   auto q = sep.get_queue();
   auto device = q.get_device();
 
@@ -123,6 +124,30 @@ OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
   return o + vectorSize;
 }
 
+/* exclusive_scan.
+ * Ranges of SYCL buffers may share a buffer, which the ping-pong above
+ * cannot handle: they are scanned on the device by mapscan.
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class ElemT, class BinaryOperation>
+OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
+                              InputIterator e, OutputIterator o, ElemT init,
+                              BinaryOperation bop, std::true_type) {
+  using value_type = typename std::iterator_traits<InputIterator>::value_type;
+  return mapscan(sep, b, e, o, init, [](value_type x) { return x; }, bop,
+                 true);
+}
+
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class ElemT, class BinaryOperation>
+OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
+                              InputIterator e, OutputIterator o, ElemT init,
+                              BinaryOperation bop) {
+  return sycl::impl::exclusive_scan(
+      sep, b, e, o, init, bop,
+      mapscan_in_buffers<InputIterator, OutputIterator>());
+}
+
 #else
 
 
@@ -135,38 +160,9 @@ OutputIterator exclusive_scan(ExecutionPolicy &snp, InputIterator b,
                               InputIterator e, OutputIterator o, T init,
                               BinaryOperation bop) {
 
-  cl::sycl::queue q(snp.get_queue());
-  auto device = q.get_device();
-  auto size = sycl::helpers::distance(b, e);
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
-#ifdef TRISYCL_CL_LANGUAGE_VERSION
-  std::vector<value_type> vect { b, e };
-  *o++ = init;
-#endif
-
-
-  {
-#ifdef TRISYCL_CL_LANGUAGE_VERSION
-    cl::sycl::buffer<value_type, 1> buffer { vect.data(), size - 1 };
-    buffer.set_final_data(o);
-#else
-    std::shared_ptr<value_type> data { new value_type[size-1],
-      [&](value_type* ptr) {
-        *o++ = init;
-        std::copy_n(ptr, size-1, o);
-      }
-    };
-    std::copy_n(b, size-1, data.get());
-    cl::sycl::buffer<value_type, 1> buffer { data, cl::sycl::range<1>{size-1} };
-#endif
-
-    auto d = compute_mapscan_descriptor(device, size - 1, sizeof(value_type));
-    buffer_mapscan(snp, q, buffer, buffer, init, d,
-                   [](value_type x) { return x; },
-                   bop);
-  }
-
-  return std::next(o, size - 1);
+  return mapscan(snp, b, e, o, init, [](value_type x) { return x; }, bop,
+                 true);
 }
 
 #endif
@@ -31,6 +31,7 @@
 
 #include <sycl/helpers/sycl_buffers.hpp>
 #include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/mapscan.hpp>
 
 namespace sycl {
 namespace impl {
@@ -40,11 +41,11 @@ namespace impl {
  * Implementation of the command group that submits a inclusive_scan kernel.
  * The kernel is implemented as a lambda.
  */
- template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
           class T, class BinaryOperation>
 OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
                               InputIterator e, OutputIterator o, T init,
-                              BinaryOperation bop) {
+                              BinaryOperation bop, std::false_type) {
   cl::sycl::queue q(sep.get_queue());
   auto device = q.get_device();
   // limits us to random access iterators :/
@@ -103,6 +104,31 @@ OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
   q.wait_and_throw();
   return o + vectorSize;
 }
+
+/* inclusive_scan.
+ * Ranges of SYCL buffers cannot be written from the host, nor used as the
+ * two buffers of the kernel above when they are the same: they are scanned
+ * on the device by mapscan.
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class T, class BinaryOperation>
+OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
+                              InputIterator e, OutputIterator o, T init,
+                              BinaryOperation bop, std::true_type) {
+  using value_type = typename std::iterator_traits<InputIterator>::value_type;
+  return mapscan(sep, b, e, o, init, [](value_type x) { return x; }, bop,
+                 false);
+}
+
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class T, class BinaryOperation>
+OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
+                              InputIterator e, OutputIterator o, T init,
+                              BinaryOperation bop) {
+  return sycl::impl::inclusive_scan(
+      sep, b, e, o, init, bop,
+      mapscan_in_buffers<InputIterator, OutputIterator>());
+}
 #else
 
 template <class ExecutionPolicy, class InputIterator, class OutputIterator,
@@ -111,31 +137,9 @@ OutputIterator inclusive_scan(ExecutionPolicy &snp, InputIterator b,
                               InputIterator e, OutputIterator o, T init,
                               BinaryOperation bop) {
 
-  auto q = snp.get_queue();
-  auto device = q.get_device();
-  size_t size = sycl::helpers::distance(b, e);
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
-  {
-#ifdef TRISYCL_CL_LANGUAGE_VERSION
-    cl::sycl::buffer<value_type, 1> buffer { b, e };
-    buffer.set_final_data(o);
-#else
-    std::shared_ptr<value_type> data { new value_type[size],
-      [&](value_type* ptr) {
-        std::copy_n(ptr, size, o);
-      }
-    };
-    std::copy_n(b, size, data.get());
-    cl::sycl::buffer<value_type, 1> buffer { data, cl::sycl::range<1>{ size } };
-#endif
-
-    auto d = compute_mapscan_descriptor(device, size, sizeof(value_type));
-    buffer_mapscan(snp, q, buffer, buffer, init, d,
-                   [](value_type x) { return x; },
-                   bop);
-  }
-
-  return std::next(o, size);
+  return mapscan(snp, b, e, o, init, [](value_type x) { return x; }, bop,
+                 false);
 }
 
 #endif
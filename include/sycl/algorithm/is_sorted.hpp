@@ -0,0 +1,236 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_IS_SORTED__
+#define __SYCL_IMPL_ALGORITHM_IS_SORTED__
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* is_sorted_group_min.
+ * Minimum of the values stored in scratch by the work-items of a work-group,
+ * left in scratch[0]. The work-group size does not need to be a power of two.
+ */
+template <typename LocalAccessor>
+inline void is_sorted_group_min(LocalAccessor scratch, size_t localId,
+                                size_t nbWorkItem, cl::sycl::nd_item<1> id) {
+  for (size_t offset = 1; offset < nbWorkItem; offset <<= 1) {
+    if (localId % (2 * offset) == 0 && localId + offset < nbWorkItem) {
+      scratch[localId] =
+          cl::sycl::min(scratch[localId], scratch[localId + offset]);
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+  }
+}
+
+/* is_sorted_until_kernel.
+ * Each work-item compares its element with the previous one and yields its
+ * position if they are out of order, and the size of the input otherwise.
+ * Each work-group then writes the minimum of these positions.
+ */
+template <typename T, class Compare>
+class is_sorted_until_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_w_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_r_acc in_;
+  sycl_w_acc out_;
+  sycl_local_acc scratch_;
+  size_t vS_;
+  Compare comp_;
+
+ public:
+  is_sorted_until_kernel(sycl_r_acc in, sycl_w_acc out,
+                         sycl_local_acc scratch, size_t vectorSize,
+                         Compare comp)
+      : in_(in), out_(out), scratch_(scratch), vS_(vectorSize), comp_(comp){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t pos = id.get_global_id(0);
+
+    scratch_[localId] =
+        (pos > 0 && pos < vS_ && comp_(in_[pos], in_[pos - 1])) ? pos : vS_;
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    is_sorted_group_min(scratch_, localId, id.get_local_range(0), id);
+
+    if (localId == 0) {
+      out_[id.get_group(0)] = scratch_[0];
+    }
+  }
+};  // class is_sorted_until_kernel
+
+/* is_sorted_min_kernel.
+ * Run by a single work-group, whose work-items walk the per work-group
+ * results of the previous step with a stride of the work-group size, and
+ * writes their minimum.
+ */
+class is_sorted_min_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_w_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_r_acc in_;
+  sycl_w_acc out_;
+  sycl_local_acc scratch_;
+  size_t length_;
+  size_t none_;
+
+ public:
+  is_sorted_min_kernel(sycl_r_acc in, sycl_w_acc out, sycl_local_acc scratch,
+                       size_t length, size_t none)
+      : in_(in),
+        out_(out),
+        scratch_(scratch),
+        length_(length),
+        none_(none){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+
+    size_t value = none_;
+    for (size_t pos = localId; pos < length_; pos += nbWorkItem) {
+      value = cl::sycl::min(value, in_[pos]);
+    }
+    scratch_[localId] = value;
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    is_sorted_group_min(scratch_, localId, nbWorkItem, id);
+
+    if (localId == 0) {
+      out_[0] = scratch_[0];
+    }
+  }
+};  // class is_sorted_min_kernel
+
+/** is_sorted_until
+ * @brief Returns an iterator to the first element of the given range that is
+ * lesser than the previous one, i.e. the end of its longest sorted prefix.
+ * A neighbour comparison kernel yields the position of the out of order
+ * elements, and the first of them is found with a min reduction on the
+ * device, so only one position is read back.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true if its first argument is ordered
+ *                before the second one
+ */
+template <class ExecutionPolicy, class ForwardIt, class Compare>
+ForwardIt is_sorted_until(ExecutionPolicy &sep, ForwardIt first,
+                          ForwardIt last, Compare comp) {
+  if (sycl::helpers::distance(first, last) < 2) {
+    return last;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<ForwardIt>::value_type type_;
+
+  // make a buffer that doesn't trigger a copy back, as we don't modify it
+  auto buf = sycl::helpers::make_const_buffer(first, last);
+  const size_t vectorSize = buf.get_count();
+
+  const auto ndRange = sep.calculateNdRange(vectorSize);
+  const size_t length =
+      ndRange.get_global_range()[0] / ndRange.get_local_range()[0];
+  auto partial = sycl::helpers::make_temp_buffer<size_t>(length);
+
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aI = buf.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = partial.template get_access<cl::sycl::access::mode::write>(h);
+    cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        scratch(ndRange.get_local_range(), h);
+    h.parallel_for<
+        cl::sycl::helpers::NameGen<0, typename ExecutionPolicy::kernelName>>(
+        ndRange, is_sorted_until_kernel<type_, Compare>(aI, aO, scratch,
+                                                        vectorSize, comp));
+  });
+
+  if (length > 1) {
+    const auto local = sep.calculateNdRange(length).get_local_range();
+    auto out = sycl::helpers::make_temp_buffer<size_t>(1);
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aI = partial.template get_access<cl::sycl::access::mode::read>(h);
+      auto aO = out.template get_access<cl::sycl::access::mode::write>(h);
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          scratch(local, h);
+      h.parallel_for(cl::sycl::nd_range<1>(local, local),
+                     is_sorted_min_kernel(aI, aO, scratch, length,
+                                          vectorSize));
+    });
+    partial = out;
+  }
+
+  auto hI = partial.template get_access<cl::sycl::access::mode::read>();
+  return std::next(first, hI[0]);
+}
+
+/** is_sorted
+ * @brief Checks whether the given range is sorted.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true if its first argument is ordered
+ *                before the second one
+ */
+template <class ExecutionPolicy, class ForwardIt, class Compare>
+bool is_sorted(ExecutionPolicy &sep, ForwardIt first, ForwardIt last,
+               Compare comp) {
+  return sycl::impl::is_sorted_until(sep, first, last, comp) == last;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_IS_SORTED__
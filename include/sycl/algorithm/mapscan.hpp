@@ -0,0 +1,352 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_MAPSCAN__
+#define __SYCL_IMPL_ALGORITHM_MAPSCAN__
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* mapscan_result.
+ * Type of the elements of [b, e) once transformed by map, which is the type
+ * of the scan
+ */
+template <typename InputIterator, typename Map>
+using mapscan_result = typename std::decay<typename std::result_of<
+    Map(typename std::iterator_traits<InputIterator>::value_type)>::type>::type;
+
+/* mapscan_in_buffers.
+ * The input and the output are ranges of SYCL buffers
+ */
+template <typename InputIterator, typename OutputIterator>
+struct mapscan_in_buffers
+    : std::integral_constant<
+          bool,
+          std::is_base_of<sycl::helpers::SyclIterator, InputIterator>::value &&
+          std::is_base_of<sycl::helpers::SyclIterator, OutputIterator>::value> {
+};
+
+/* mapscan_in_host_memory.
+ * The input and the output are contiguous in host memory and the output
+ * holds the type of the scan, so buffers can use them directly
+ */
+template <typename InputIterator, typename OutputIterator, typename Map>
+struct mapscan_in_host_memory
+    : std::integral_constant<
+          bool,
+          sycl::helpers::is_contiguous_iterator<InputIterator>::value &&
+          sycl::helpers::is_contiguous_iterator<OutputIterator>::value &&
+          std::is_same<
+              typename std::iterator_traits<OutputIterator>::value_type,
+              mapscan_result<InputIterator, Map>>::value> {};
+
+/* same_buffer.
+ * Tells whether two buffers are the same, which they can only be if they
+ * have the same type
+ */
+template <typename A, typename InputAlloc, typename B, typename OutputAlloc>
+bool same_buffer(cl::sycl::buffer<A, 1, InputAlloc>,
+                 cl::sycl::buffer<B, 1, OutputAlloc>) {
+  return false;
+}
+
+template <typename A, typename Alloc>
+bool same_buffer(cl::sycl::buffer<A, 1, Alloc> a,
+                 cl::sycl::buffer<A, 1, Alloc> b) {
+  return a == b;
+}
+
+/* mapscan_get.
+ * Reads the element at it on the host, through a host accessor for the
+ * iterators on SYCL buffers
+ */
+template <typename Iterator,
+          typename std::enable_if<std::is_base_of<
+              sycl::helpers::SyclIterator, Iterator>::value>::type* = nullptr>
+typename std::iterator_traits<Iterator>::value_type mapscan_get(Iterator it) {
+  auto buffer = it.get_buffer();
+  auto h = buffer.template get_access<cl::sycl::access::mode::read>(
+      cl::sycl::range<1>{1}, cl::sycl::id<1>{it.get_pos()});
+  return h[it.get_pos()];
+}
+
+template <typename Iterator,
+          typename std::enable_if<!std::is_base_of<
+              sycl::helpers::SyclIterator, Iterator>::value>::type* = nullptr>
+typename std::iterator_traits<Iterator>::value_type mapscan_get(Iterator it) {
+  return *it;
+}
+
+/* mapscan_set.
+ * Writes x to the element at it on the host, through a host accessor for
+ * the iterators on SYCL buffers
+ */
+template <typename Iterator, typename T,
+          typename std::enable_if<std::is_base_of<
+              sycl::helpers::SyclIterator, Iterator>::value>::type* = nullptr>
+void mapscan_set(Iterator it, T x) {
+  auto buffer = it.get_buffer();
+  auto h = buffer.template get_access<cl::sycl::access::mode::write>(
+      cl::sycl::range<1>{1}, cl::sycl::id<1>{it.get_pos()});
+  h[it.get_pos()] = x;
+}
+
+template <typename Iterator, typename T,
+          typename std::enable_if<!std::is_base_of<
+              sycl::helpers::SyclIterator, Iterator>::value>::type* = nullptr>
+void mapscan_set(Iterator it, T x) {
+  *it = x;
+}
+
+/* mapscan_copy.
+ * Scan through host copies of the input and the output, for iterators whose
+ * elements cannot be used directly by a buffer
+ */
+template <typename ExecutionPolicy, typename InputIterator,
+          typename OutputIterator, typename T, typename Map, typename Reduce>
+OutputIterator mapscan_copy(ExecutionPolicy &snp, InputIterator b,
+                            InputIterator e, OutputIterator o, T init,
+                            Map map, Reduce red, bool exclusive) {
+  using B = mapscan_result<InputIterator, Map>;
+  auto q = snp.get_queue();
+  size_t size = sycl::helpers::distance(b, e);
+  if (size == 0)
+    return o;
+
+  size_t scan_size = exclusive ? size - 1 : size;
+  B first = B(init);
+
+  if (scan_size > 0) {
+    auto out = exclusive ? std::next(o) : o;
+    auto input_buffer =
+        sycl::helpers::make_const_buffer(b, std::next(b, scan_size));
+#ifdef TRISYCL_CL_LANGUAGE_VERSION
+    cl::sycl::buffer<B, 1> output_buffer { cl::sycl::range<1> { scan_size } };
+    output_buffer.set_final_data(out);
+#else
+    std::shared_ptr<B> data { new B[scan_size], [out, scan_size](B* ptr) {
+      std::copy_n(ptr, scan_size, out);
+      delete[] ptr;
+    }};
+    cl::sycl::buffer<B, 1> output_buffer {
+      data, cl::sycl::range<1> { scan_size } };
+#endif
+
+    auto d = compute_mapscan_descriptor(q.get_device(), scan_size, sizeof(B));
+    buffer_mapscan(snp, q, input_buffer, output_buffer, first, d, map, red);
+  }
+
+  if (exclusive)
+    *o = first;
+  return std::next(o, size);
+}
+
+/* mapscan_in_place.
+ * Inclusive scan of the size elements at data, in place
+ */
+template <typename ExecutionPolicy, typename B, typename Map, typename Reduce>
+void mapscan_in_place(ExecutionPolicy &snp, B *data, size_t size, B first,
+                      Map map, Reduce red, std::true_type) {
+  auto q = snp.get_queue();
+  cl::sycl::buffer<B, 1> buffer { data, cl::sycl::range<1> { size } };
+  auto d = compute_mapscan_descriptor(q.get_device(), size, sizeof(B));
+  buffer_mapscan(snp, q, buffer, buffer, first, d, map, red);
+}
+
+template <typename ExecutionPolicy, typename B, typename Map, typename Reduce>
+void mapscan_in_place(ExecutionPolicy &snp, B *data, size_t size, B first,
+                      Map map, Reduce red, std::false_type) {
+  // a scan is only in place when the input and the output have the same type
+}
+
+/* mapscan.
+ * Scan of the elements of [b, e) transformed by map, written from o. When
+ * exclusive is set, o receives init followed by the scan of all the elements
+ * but the last one, otherwise the scan includes init and every element.
+ * Map is not applied on init.
+ *
+ * This overload scans ranges of SYCL buffers on the device, without going
+ * through the host.
+ */
+template <typename ExecutionPolicy, typename InputIterator,
+          typename OutputIterator, typename T, typename Map, typename Reduce,
+          typename std::enable_if<mapscan_in_buffers<
+              InputIterator, OutputIterator>::value>::type* = nullptr>
+OutputIterator mapscan(ExecutionPolicy &snp, InputIterator b, InputIterator e,
+                       OutputIterator o, T init, Map map, Reduce red,
+                       bool exclusive) {
+  using B = mapscan_result<InputIterator, Map>;
+  auto q = snp.get_queue();
+  size_t size = sycl::helpers::distance(b, e);
+  if (size == 0)
+    return o;
+
+  auto input_buffer = b.get_buffer();
+  auto output_buffer = o.get_buffer();
+  size_t input_pos = b.get_pos();
+  size_t output_pos = o.get_pos();
+  size_t scan_size = exclusive ? size - 1 : size;
+  B first = B(init);
+  auto d = compute_mapscan_descriptor(q.get_device(), scan_size, sizeof(B));
+
+  bool overlap = same_buffer(input_buffer, output_buffer) &&
+                 input_pos < output_pos + size &&
+                 output_pos < input_pos + size;
+  bool in_place = !exclusive && overlap && input_pos == output_pos;
+
+  if (!overlap || in_place) {
+    if (!exclusive) {
+      buffer_mapscan(snp, q, input_buffer, output_buffer, first, d, map, red,
+                     input_pos, output_pos);
+      return std::next(o, size);
+    }
+    // the scan is shifted by one element, init goes in front of it
+    buffer_mapscan(snp, q, input_buffer, output_buffer, first, d, map, red,
+                   input_pos, output_pos + 1);
+    q.submit([&] (cl::sycl::handler &cgh) {
+      auto output = output_buffer.template get_access
+        <cl::sycl::access::mode::write>(cgh);
+      cgh.single_task<cl::sycl::helpers::NameGen<6,
+          typename ExecutionPolicy::kernelName>>([=]() {
+        output[output_pos] = first;
+      });
+    });
+    return std::next(o, size);
+  }
+
+  // the output would overwrite input not read yet by other work-groups: scan
+  // in a temporary buffer, then copy it, shifted if exclusive, to the output
+  auto scan = sycl::helpers::make_temp_buffer<B>(std::max(scan_size,
+                                                          size_t(1)));
+  buffer_mapscan(snp, q, input_buffer, scan, first, d, map, red, input_pos);
+  q.submit([&] (cl::sycl::handler &cgh) {
+    auto output = output_buffer.template get_access
+      <cl::sycl::access::mode::write>(cgh);
+    auto read_scan = scan.template get_access
+      <cl::sycl::access::mode::read>(cgh);
+    cgh.parallel_for<cl::sycl::helpers::NameGen<7,
+        typename ExecutionPolicy::kernelName>>(cl::sycl::range<1> { size },
+                                               [=](cl::sycl::id<1> id) {
+      size_t pos = id[0];
+      if (!exclusive)
+        output[output_pos + pos] = read_scan[pos];
+      else
+        output[output_pos + pos] = (pos == 0) ? first : read_scan[pos - 1];
+    });
+  });
+  return std::next(o, size);
+}
+
+/* mapscan.
+ * This overload wraps the input and the output in buffers using the host
+ * memory directly, without any copy on the host. Overlapping ranges that are
+ * not an in-place inclusive scan go through host copies.
+ */
+template <typename ExecutionPolicy, typename InputIterator,
+          typename OutputIterator, typename T, typename Map, typename Reduce,
+          typename std::enable_if<
+              !mapscan_in_buffers<InputIterator, OutputIterator>::value &&
+              mapscan_in_host_memory<InputIterator, OutputIterator,
+                                     Map>::value>::type* = nullptr>
+OutputIterator mapscan(ExecutionPolicy &snp, InputIterator b, InputIterator e,
+                       OutputIterator o, T init, Map map, Reduce red,
+                       bool exclusive) {
+  using A = typename std::iterator_traits<InputIterator>::value_type;
+  using B = mapscan_result<InputIterator, Map>;
+  auto q = snp.get_queue();
+  size_t size = sycl::helpers::distance(b, e);
+  if (size == 0)
+    return o;
+
+  const A *input = &*b;
+  B *output = &*o;
+  size_t scan_size = exclusive ? size - 1 : size;
+  B first = B(init);
+
+  auto input_begin = reinterpret_cast<const char *>(input);
+  auto input_end = reinterpret_cast<const char *>(input + size);
+  auto output_begin = reinterpret_cast<const char *>(output);
+  auto output_end = reinterpret_cast<const char *>(output + size);
+  std::less<const char *> less;
+  bool overlap = less(input_begin, output_end) && less(output_begin, input_end);
+  bool in_place = !exclusive && std::is_same<A, B>::value &&
+                  input_begin == output_begin;
+
+  if (in_place) {
+    mapscan_in_place(snp, output, size, first, map, red,
+                     std::is_same<A, B>());
+    return std::next(o, size);
+  }
+  if (overlap)
+    return mapscan_copy(snp, b, e, o, init, map, red, exclusive);
+
+  if (scan_size > 0) {
+    cl::sycl::buffer<A, 1> input_buffer {
+      input, cl::sycl::range<1> { scan_size } };
+    cl::sycl::buffer<B, 1> output_buffer {
+      exclusive ? output + 1 : output, cl::sycl::range<1> { scan_size } };
+    auto d = compute_mapscan_descriptor(q.get_device(), scan_size, sizeof(B));
+    buffer_mapscan(snp, q, input_buffer, output_buffer, first, d, map, red);
+  }
+
+  if (exclusive)
+    *output = first;
+  return std::next(o, size);
+}
+
+/* mapscan.
+ * This overload goes through host copies of the input and the output.
+ */
+template <typename ExecutionPolicy, typename InputIterator,
+          typename OutputIterator, typename T, typename Map, typename Reduce,
+          typename std::enable_if<
+              !mapscan_in_buffers<InputIterator, OutputIterator>::value &&
+              !mapscan_in_host_memory<InputIterator, OutputIterator,
+                                      Map>::value>::type* = nullptr>
+OutputIterator mapscan(ExecutionPolicy &snp, InputIterator b, InputIterator e,
+                       OutputIterator o, T init, Map map, Reduce red,
+                       bool exclusive) {
+  return mapscan_copy(snp, b, e, o, init, map, red, exclusive);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_MAPSCAN__
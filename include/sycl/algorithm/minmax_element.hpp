@@ -0,0 +1,191 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
+#define __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* indexed_value.
+ * An element of the range along with its position. The position is the size
+ * of the range for the initial value of the reductions, which is not an
+ * element of the range.
+ */
+template <typename T>
+struct indexed_value {
+  T value;
+  std::size_t index;
+};
+
+/* minmax_indexed_value.
+ * Accumulator of minmax_element, the smallest and the largest elements.
+ */
+template <typename T>
+struct minmax_indexed_value {
+  indexed_value<T> min;
+  indexed_value<T> max;
+};
+
+/* select_min.
+ * The smallest of a and b, the first one if they are equivalent.
+ */
+template <typename T, typename Compare>
+indexed_value<T> select_min(indexed_value<T> a, indexed_value<T> b,
+                            std::size_t size, Compare comp) {
+  if (a.index == size) return b;
+  if (b.index == size) return a;
+  if (comp(b.value, a.value)) return b;
+  if (comp(a.value, b.value)) return a;
+  return (b.index < a.index) ? b : a;
+}
+
+/* select_max.
+ * The largest of a and b. If they are equivalent, the first one when
+ * first_largest is true and the last one otherwise.
+ */
+template <typename T, typename Compare>
+indexed_value<T> select_max(indexed_value<T> a, indexed_value<T> b,
+                            std::size_t size, Compare comp,
+                            bool first_largest) {
+  if (a.index == size) return b;
+  if (b.index == size) return a;
+  if (comp(a.value, b.value)) return b;
+  if (comp(b.value, a.value)) return a;
+  return ((b.index < a.index) == first_largest) ? b : a;
+}
+
+/* min_element.
+ * Reduces the (value, position) pairs of the range with buffer_mapreduce,
+ * keeping the first smallest element.
+ */
+template <typename ExecutionPolicy, typename ForwardIt, typename Compare>
+ForwardIt min_element(ExecutionPolicy &snp, ForwardIt b, ForwardIt e,
+                      Compare comp) {
+  const auto size = sycl::helpers::distance(b, e);
+  if (size <= 0) {
+    return e;
+  }
+
+  const auto q = snp.get_queue();
+  const auto device = q.get_device();
+  using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+  using B = indexed_value<value_type>;
+  const std::size_t n = size;
+
+  const auto d = compute_mapreduce_descriptor(device, size, sizeof(B));
+
+  const auto input_buff = sycl::helpers::make_const_buffer(b, e);
+
+  const auto res = buffer_mapreduce(
+      snp, q, input_buff, B{value_type{}, n}, d,
+      [](std::size_t pos, value_type x) { return B{x, pos}; },
+      [n, comp](B x, B y) { return select_min(x, y, n, comp); });
+
+  return std::next(b, res.index);
+}
+
+/* max_element.
+ * Reduces the (value, position) pairs of the range with buffer_mapreduce,
+ * keeping the first largest element.
+ */
+template <typename ExecutionPolicy, typename ForwardIt, typename Compare>
+ForwardIt max_element(ExecutionPolicy &snp, ForwardIt b, ForwardIt e,
+                      Compare comp) {
+  const auto size = sycl::helpers::distance(b, e);
+  if (size <= 0) {
+    return e;
+  }
+
+  const auto q = snp.get_queue();
+  const auto device = q.get_device();
+  using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+  using B = indexed_value<value_type>;
+  const std::size_t n = size;
+
+  const auto d = compute_mapreduce_descriptor(device, size, sizeof(B));
+
+  const auto input_buff = sycl::helpers::make_const_buffer(b, e);
+
+  const auto res = buffer_mapreduce(
+      snp, q, input_buff, B{value_type{}, n}, d,
+      [](std::size_t pos, value_type x) { return B{x, pos}; },
+      [n, comp](B x, B y) { return select_max(x, y, n, comp, true); });
+
+  return std::next(b, res.index);
+}
+
+/* minmax_element.
+ * Computes both the first smallest and the last largest elements, as
+ * std::minmax_element does, in a single buffer_mapreduce.
+ */
+template <typename ExecutionPolicy, typename ForwardIt, typename Compare>
+std::pair<ForwardIt, ForwardIt> minmax_element(ExecutionPolicy &snp,
+                                               ForwardIt b, ForwardIt e,
+                                               Compare comp) {
+  const auto size = sycl::helpers::distance(b, e);
+  if (size <= 0) {
+    return std::make_pair(e, e);
+  }
+
+  const auto q = snp.get_queue();
+  const auto device = q.get_device();
+  using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+  using A = indexed_value<value_type>;
+  using B = minmax_indexed_value<value_type>;
+  const std::size_t n = size;
+
+  const auto d = compute_mapreduce_descriptor(device, size, sizeof(B));
+
+  const auto input_buff = sycl::helpers::make_const_buffer(b, e);
+
+  const auto res = buffer_mapreduce(
+      snp, q, input_buff, B{A{value_type{}, n}, A{value_type{}, n}}, d,
+      [](std::size_t pos, value_type x) { return B{A{x, pos}, A{x, pos}}; },
+      [n, comp](B x, B y) {
+        return B{select_min(x.min, y.min, n, comp),
+                 select_max(x.max, y.max, n, comp, false)};
+      });
+
+  return std::make_pair(std::next(b, res.min.index),
+                        std::next(b, res.max.index));
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
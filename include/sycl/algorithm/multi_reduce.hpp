@@ -0,0 +1,156 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_MULTI_REDUCE__
+#define __SYCL_IMPL_ALGORITHM_MULTI_REDUCE__
+
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_map_reduce.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* multi_reduce_nil, multi_reduce_cons.
+ * Accumulator of multi_reduce, a list holding one value per reduction.
+ * std::tuple is not trivially copyable, so it cannot be stored in a buffer.
+ */
+struct multi_reduce_nil {};
+
+template <typename Head, typename Tail>
+struct multi_reduce_cons {
+  Head head;
+  Tail tail;
+};
+
+/* multi_reduce_pack.
+ * Applies all the map_reduce of the pack to the accumulator at once.
+ */
+template <typename... MapReduces>
+struct multi_reduce_pack {
+  typedef multi_reduce_nil value_type;
+  typedef std::tuple<> tuple_type;
+
+  value_type init() const { return value_type{}; }
+
+  template <typename A>
+  value_type map(const A &) const {
+    return value_type{};
+  }
+
+  value_type reduce(const value_type &, const value_type &) const {
+    return value_type{};
+  }
+
+  tuple_type to_tuple(const value_type &) const { return tuple_type{}; }
+};
+
+template <typename T, typename Map, typename Reduce, typename... MapReduces>
+struct multi_reduce_pack<sycl::helpers::map_reduce<T, Map, Reduce>,
+                         MapReduces...> {
+  typedef multi_reduce_pack<MapReduces...> tail_type;
+  typedef multi_reduce_cons<T, typename tail_type::value_type> value_type;
+  typedef decltype(std::tuple_cat(
+      std::declval<std::tuple<T>>(),
+      std::declval<typename tail_type::tuple_type>())) tuple_type;
+
+  sycl::helpers::map_reduce<T, Map, Reduce> head;
+  tail_type tail;
+
+  value_type init() const { return value_type{head.init, tail.init()}; }
+
+  template <typename A>
+  value_type map(const A &x) const {
+    return value_type{head.map(x), tail.map(x)};
+  }
+
+  value_type reduce(const value_type &a, const value_type &b) const {
+    return value_type{head.reduce(a.head, b.head),
+                      tail.reduce(a.tail, b.tail)};
+  }
+
+  tuple_type to_tuple(const value_type &v) const {
+    return std::tuple_cat(std::tuple<T>(v.head), tail.to_tuple(v.tail));
+  }
+};
+
+inline multi_reduce_pack<> make_multi_reduce_pack() {
+  return multi_reduce_pack<>{};
+}
+
+template <typename MapReduce, typename... MapReduces>
+multi_reduce_pack<MapReduce, MapReduces...> make_multi_reduce_pack(
+    MapReduce head, MapReduces... tail) {
+  return multi_reduce_pack<MapReduce, MapReduces...>{
+      head, make_multi_reduce_pack(tail...)};
+}
+
+/* multi_reduce.
+ * Computes all the given map_reduce over the range [b, e) with a single
+ * buffer_mapreduce, so the range is copied to the device and read from
+ * global memory only once. Returns the results in a std::tuple, in the
+ * order of the map_reduce.
+ */
+template <typename ExecutionPolicy, typename Iterator, typename... MapReduces>
+typename multi_reduce_pack<MapReduces...>::tuple_type multi_reduce(
+    ExecutionPolicy &snp, Iterator b, Iterator e, MapReduces... map_reduces) {
+  typedef multi_reduce_pack<MapReduces...> pack_type;
+  typedef typename pack_type::value_type B;
+
+  auto pack = make_multi_reduce_pack(map_reduces...);
+
+  auto size = sycl::helpers::distance(b, e);
+  if (size <= 0)
+    return pack.to_tuple(pack.init());
+
+  auto q = snp.get_queue();
+  auto device = q.get_device();
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+  auto d = compute_mapreduce_descriptor(device, size, sizeof(B));
+
+  auto input_buff = sycl::helpers::make_const_buffer(b, e);
+
+  auto map = [=](size_t, value_type x) { return pack.map(x); };
+  auto reduce = [=](B x, B y) { return pack.reduce(x, y); };
+
+  return pack.to_tuple(
+      buffer_mapreduce(snp, q, input_buff, pack.init(), d, map, reduce));
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_MULTI_REDUCE__
@@ -37,6 +37,7 @@
 // SYCL helpers header
 #include <sycl/helpers/sycl_buffers.hpp>
 #include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_future.hpp>
 #include <sycl/algorithm/algorithm_composite_patterns.hpp>
 #include <sycl/algorithm/buffer_algorithms.hpp>
 #include <sycl/execution_policy>
@@ -44,6 +45,58 @@
 namespace sycl {
 namespace impl {
 
+/*
+ * Compensated reduce algorithm, selected by a compensated_plus binary
+ * operation. The kernels are submitted, the returned handle gives access to
+ * the result
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename U,
+          typename T>
+sycl::helpers::sycl_future<T> reduce_async(
+    ExecutionPolicy &snp, Iterator b, Iterator e,
+    U init,
+    sycl::helpers::compensated_plus<T> bop) {
+
+  auto q = snp.get_queue();
+  auto device = q.get_device();
+  auto size = sycl::helpers::distance(b, e);
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+  if (size <= 0)
+    return sycl::helpers::sycl_future<T>(T(init));
+
+  auto d = compute_mapreduce_descriptor(
+      device, size, sizeof(sycl::helpers::compensated_value<T>));
+
+  auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  cl::sycl::buffer<T, 1> output_buff { cl::sycl::range<1> { 1 } };
+
+  auto map = [](size_t, value_type x) { return T(x); };
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_compensated_mapreduce(snp, q, input_buff, output_buff,
+                                            T(init), d, map, temporaries);
+  return sycl::helpers::sycl_future<T>(output_buff, event,
+                                       temporaries.share());
+}
+
+/*
+ * Compensated reduce algorithm, selected by a compensated_plus binary
+ * operation
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename U,
+          typename T>
+T reduce(ExecutionPolicy &snp, Iterator b, Iterator e,
+         U init,
+         sycl::helpers::compensated_plus<T> bop) {
+  return sycl::impl::reduce_async(snp, b, e, init, bop).get();
+}
+
 /* reduce.
  * Implementation of the command group that submits a reduce kernel.
  * The kernel is implemented as a lambda.
@@ -51,28 +104,44 @@ namespace impl {
  * input-output
  */
 #ifdef SYCL_PSTL_USE_OLD_ALGO
+/* reduce_async.
+ * The reduction overwrites its input, so it runs on a temporary copy of the
+ * range. The kernels are submitted, the returned handle keeps the copy alive
+ * and gives access to the result.
+ */
 template <typename ExecutionPolicy,
           typename Iterator,
           typename T,
           typename BinaryOperation>
-typename std::iterator_traits<Iterator>::value_type reduce(
+sycl::helpers::sycl_future<T> reduce_async(
     ExecutionPolicy &sep, Iterator b, Iterator e, T init, BinaryOperation bop) {
   cl::sycl::queue q(sep.get_queue());
 
   auto vectorSize = sycl::helpers::distance(b, e);
 
   if (vectorSize < 1) {
-    return init;
+    return sycl::helpers::sycl_future<T>(init);
   }
 
   auto device = q.get_device();
 
   typedef typename std::iterator_traits<Iterator>::value_type type_;
-  auto bufI = sycl::helpers::make_const_buffer(b, e);
+  auto bufIn = sycl::helpers::make_const_buffer(b, e);
+  auto bufI = sycl::helpers::make_temp_buffer<type_>(vectorSize);
+  cl::sycl::buffer<T, 1> bufR { cl::sycl::range<1> { 1 } };
   auto length = vectorSize;
   auto ndRange = sep.calculateNdRange(length);
   const auto local = ndRange.get_local_range()[0];
 
+  q.submit([&](cl::sycl::handler &h) {
+    auto aIn = bufIn.template get_access<cl::sycl::access::mode::read>(h);
+    auto aI = bufI.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<cl::sycl::helpers::NameGen<
+        10, typename ExecutionPolicy::kernelName>>(
+        cl::sycl::range<1>(vectorSize),
+        [aIn, aI](cl::sycl::item<1> id) { aI[id] = aIn[id]; });
+  });
+
   auto f = [&length, &ndRange, local, &bufI, bop](cl::sycl::handler &h) mutable {
     auto aI = bufI.template get_access<cl::sycl::access::mode::read_write>(h);
     cl::sycl::accessor<type_, 1, cl::sycl::access::mode::read_write,
@@ -93,21 +162,44 @@ typename std::iterator_traits<Iterator>::value_type reduce(
     ndRange = cl::sycl::nd_range<1>{cl::sycl::range<1>(std::max(length, local)),
                                     ndRange.get_local_range()};
   } while (length > 1);
-  q.wait_and_throw();
-  auto hI = bufI.template get_access<cl::sycl::access::mode::read>();
-  return bop(hI[0], init);
+
+  auto event = q.submit([&](cl::sycl::handler &h) {
+    auto aI = bufI.template get_access<cl::sycl::access::mode::read>(h);
+    auto aR = bufR.template get_access<cl::sycl::access::mode::write>(h);
+    h.single_task<cl::sycl::helpers::NameGen<
+        11, typename ExecutionPolicy::kernelName>>(
+        [aI, aR, init, bop]() { aR[0] = bop(aI[0], init); });
+  });
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(bufIn);
+  temporaries.keep(bufI);
+  return sycl::helpers::sycl_future<T>(bufR, event, temporaries.share());
+}
+
+/* reduce.
+ * Waits for the result of reduce_async.
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename T,
+          typename BinaryOperation>
+typename std::iterator_traits<Iterator>::value_type reduce(
+    ExecutionPolicy &sep, Iterator b, Iterator e, T init, BinaryOperation bop) {
+  return sycl::impl::reduce_async(sep, b, e, init, bop).get();
 }
 #else
 
 
 /*
- * Reduce algorithm
+ * Asynchronous reduce algorithm
+ * The kernels are submitted, the returned handle gives access to the result
  */
 template <typename ExecutionPolicy,
           typename Iterator,
           typename T,
           typename BinaryOperation>
-typename std::iterator_traits<Iterator>::value_type reduce(
+sycl::helpers::sycl_future<T> reduce_async(
     ExecutionPolicy &snp, Iterator b, Iterator e, T init, BinaryOperation bop) {
 
   auto q = snp.get_queue();
@@ -116,19 +208,83 @@ typename std::iterator_traits<Iterator>::value_type reduce(
   using value_type = typename std::iterator_traits<Iterator>::value_type;
 
   if (size <= 0)
-    return init;
+    return sycl::helpers::sycl_future<T>(init);
 
   auto d = compute_mapreduce_descriptor(device, size, sizeof(value_type));
 
   auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  cl::sycl::buffer<T, 1> output_buff { cl::sycl::range<1> { 1 } };
 
   auto map = [](size_t, value_type x) { return x; };
 
-  return buffer_mapreduce(snp, q, input_buff, init, d, map, bop);
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_mapreduce(snp, q, input_buff, output_buff, init, d, map,
+                                bop, temporaries);
+  return sycl::helpers::sycl_future<T>(output_buff, event,
+                                       temporaries.share());
+}
+
+/*
+ * Reduce algorithm
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename T,
+          typename BinaryOperation>
+typename std::iterator_traits<Iterator>::value_type reduce(
+    ExecutionPolicy &snp, Iterator b, Iterator e, T init, BinaryOperation bop) {
+  return sycl::impl::reduce_async(snp, b, e, init, bop).get();
 }
 
 #endif // __COMPUTECPP__
 
+/*
+ * Reduce algorithm writing its result to output_buff[output_pos] on the
+ * device. Returns a handle on the kernel writing it without waiting, so
+ * that later kernels can use the result without a round trip to the host.
+ * The handle keeps the input and temporary buffers alive, destroying its
+ * last copy waits for the kernels
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename T,
+          typename BinaryOperation,
+          typename OutputAlloc>
+sycl::helpers::sycl_event_handle reduce(
+    ExecutionPolicy &snp, Iterator b, Iterator e, T init, BinaryOperation bop,
+    cl::sycl::buffer<T, 1, OutputAlloc> output_buff, size_t output_pos) {
+
+  auto q = snp.get_queue();
+  auto device = q.get_device();
+  auto size = sycl::helpers::distance(b, e);
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+  if (size <= 0) {
+    return sycl::helpers::sycl_event_handle(
+        q.submit([&] (cl::sycl::handler &cgh) {
+      auto output = output_buff.template get_access
+        <cl::sycl::access::mode::write>(cgh);
+      cgh.single_task<cl::sycl::helpers::NameGen<3,
+          typename ExecutionPolicy::kernelName>>([=]() {
+        output[output_pos] = init;
+      });
+    }));
+  }
+
+  auto d = compute_mapreduce_descriptor(device, size, sizeof(value_type));
+
+  auto input_buff = sycl::helpers::make_const_buffer(b, e);
+
+  auto map = [](size_t, value_type x) { return T(x); };
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_mapreduce(snp, q, input_buff, output_buff, init, d, map,
+                                bop, temporaries, output_pos);
+  return sycl::helpers::sycl_event_handle(event, temporaries.share());
+}
+
 }  // namespace impl
 }  // namespace sycl
 
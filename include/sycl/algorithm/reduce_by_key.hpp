@@ -0,0 +1,121 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
+#define __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/segmented_scan.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* reduce_by_key.
+ * For every run of consecutive keys equivalent with respect to pred, writes
+ * the first key of the run to keys_out and the reduction with op of the
+ * corresponding values to values_out. Returns the ends of both outputs.
+ *
+ * The values are reduced with buffer_segmented_scan, and the last element
+ * of every run is written at the position given by the number of heads
+ * before it. Only the number of runs is read back to the host.
+ */
+template <typename ExecutionPolicy, typename KeyIt, typename ValueIt,
+          typename KeyOutIt, typename ValueOutIt, typename BinaryPredicate,
+          typename BinaryOperation>
+std::pair<KeyOutIt, ValueOutIt> reduce_by_key(
+    ExecutionPolicy &snp, KeyIt keys_first, KeyIt keys_last,
+    ValueIt values_first, KeyOutIt keys_out, ValueOutIt values_out,
+    BinaryPredicate pred, BinaryOperation op) {
+  const auto size = sycl::helpers::distance(keys_first, keys_last);
+  if (size <= 0) {
+    return std::make_pair(keys_out, values_out);
+  }
+
+  auto q = snp.get_queue();
+  using value_type = typename std::iterator_traits<ValueIt>::value_type;
+  const std::size_t n = size;
+
+  auto keys_buff = sycl::helpers::make_const_buffer(keys_first, keys_last);
+  auto values_buff = sycl::helpers::make_const_buffer(
+      values_first, std::next(values_first, n));
+  auto segment_buff = buffer_segmented_scan<value_type>(
+      snp, q, keys_buff, values_buff, n, pred, op);
+
+  std::size_t nb_segments;
+  {
+    auto segments =
+        segment_buff.template get_access<cl::sycl::access::mode::read>(
+            cl::sycl::range<1>{1}, cl::sycl::id<1>{n - 1});
+    nb_segments = segments[n - 1].count;
+  }
+
+  auto keys_end = std::next(keys_out, nb_segments);
+  auto values_end = std::next(values_out, nb_segments);
+  {
+    auto keys_out_buff = sycl::helpers::make_buffer(keys_out, keys_end);
+    auto values_out_buff = sycl::helpers::make_buffer(values_out, values_end);
+
+    // Compaction: the last element of every run holds its reduction
+    q.submit([&](cl::sycl::handler &h) {
+      auto keys =
+          keys_buff.template get_access<cl::sycl::access::mode::read>(h);
+      auto segments =
+          segment_buff.template get_access<cl::sycl::access::mode::read>(h);
+      auto k_out = keys_out_buff.template get_access<
+          cl::sycl::access::mode::discard_write>(h);
+      auto v_out = values_out_buff.template get_access<
+          cl::sycl::access::mode::discard_write>(h);
+      h.parallel_for<
+          cl::sycl::helpers::NameGen<3, typename ExecutionPolicy::kernelName>>(
+          cl::sycl::range<1>{n}, [=](cl::sycl::item<1> it) {
+            const std::size_t pos = it.get_linear_id();
+            if (segments[pos].head) {
+              k_out[segments[pos].count - 1] = keys[pos];
+            }
+            if (pos == n - 1 || !pred(keys[pos], keys[pos + 1])) {
+              v_out[segments[pos].count - 1] = segments[pos].value;
+            }
+          });
+    });
+  }
+
+  return std::make_pair(keys_end, values_end);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
@@ -0,0 +1,139 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
+#define __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
+
+#include <iterator>
+#include <type_traits>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/segmented_scan.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* scan_by_key.
+ * Scans with op the values of every run of consecutive keys equivalent with
+ * respect to pred, writing the result from result. When exclusive is set,
+ * every run starts with init and leaves out its last value, otherwise init
+ * is not used.
+ *
+ * The runs are scanned with buffer_segmented_scan, the output is then
+ * written from the scanned segments.
+ */
+template <typename ExecutionPolicy, typename KeyIt, typename ValueIt,
+          typename OutputIt, typename T, typename BinaryPredicate,
+          typename BinaryOperation>
+OutputIt scan_by_key(ExecutionPolicy &snp, KeyIt keys_first, KeyIt keys_last,
+                     ValueIt values_first, OutputIt result, T init,
+                     BinaryPredicate pred, BinaryOperation op,
+                     bool exclusive) {
+  const auto size = sycl::helpers::distance(keys_first, keys_last);
+  if (size <= 0) {
+    return result;
+  }
+
+  auto q = snp.get_queue();
+  using value_type = typename std::iterator_traits<ValueIt>::value_type;
+  const std::size_t n = size;
+  const value_type first = value_type(init);
+
+  auto keys_buff = sycl::helpers::make_const_buffer(keys_first, keys_last);
+  auto values_buff = sycl::helpers::make_const_buffer(
+      values_first, std::next(values_first, n));
+  auto segment_buff = buffer_segmented_scan<value_type>(
+      snp, q, keys_buff, values_buff, n, pred, op);
+
+  {
+    auto result_buff = sycl::helpers::make_buffer(result, std::next(result, n));
+
+    // The exclusive scan of an element is the inclusive scan of the previous
+    // element of its run
+    q.submit([&](cl::sycl::handler &h) {
+      auto segments =
+          segment_buff.template get_access<cl::sycl::access::mode::read>(h);
+      auto out = result_buff.template get_access<
+          cl::sycl::access::mode::discard_write>(h);
+      h.parallel_for<
+          cl::sycl::helpers::NameGen<3, typename ExecutionPolicy::kernelName>>(
+          cl::sycl::range<1>{n}, [=](cl::sycl::item<1> it) {
+            const std::size_t pos = it.get_linear_id();
+            if (!exclusive) {
+              out[pos] = segments[pos].value;
+            } else if (segments[pos].head) {
+              out[pos] = first;
+            } else {
+              out[pos] = op(first, segments[pos - 1].value);
+            }
+          });
+    });
+  }
+
+  return std::next(result, n);
+}
+
+/* inclusive_scan_by_key.
+ * Inclusive scan with op of the values of every run of consecutive keys
+ * equivalent with respect to pred
+ */
+template <typename ExecutionPolicy, typename KeyIt, typename ValueIt,
+          typename OutputIt, typename BinaryPredicate,
+          typename BinaryOperation>
+OutputIt inclusive_scan_by_key(ExecutionPolicy &snp, KeyIt keys_first,
+                               KeyIt keys_last, ValueIt values_first,
+                               OutputIt result, BinaryPredicate pred,
+                               BinaryOperation op) {
+  using value_type = typename std::iterator_traits<ValueIt>::value_type;
+  return scan_by_key(snp, keys_first, keys_last, values_first, result,
+                     value_type{}, pred, op, false);
+}
+
+/* exclusive_scan_by_key.
+ * Exclusive scan with op of the values of every run of consecutive keys
+ * equivalent with respect to pred, every run starting with init
+ */
+template <typename ExecutionPolicy, typename KeyIt, typename ValueIt,
+          typename OutputIt, typename T, typename BinaryPredicate,
+          typename BinaryOperation>
+OutputIt exclusive_scan_by_key(ExecutionPolicy &snp, KeyIt keys_first,
+                               KeyIt keys_last, ValueIt values_first,
+                               OutputIt result, T init, BinaryPredicate pred,
+                               BinaryOperation op) {
+  return scan_by_key(snp, keys_first, keys_last, values_first, result, init,
+                     pred, op, true);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
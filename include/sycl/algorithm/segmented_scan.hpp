@@ -0,0 +1,111 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_SEGMENTED_SCAN__
+#define __SYCL_IMPL_ALGORITHM_SEGMENTED_SCAN__
+
+#include <cstddef>
+
+// SYCL helpers header
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* key_segment.
+ * Element of the segmented scan of the algorithms by key. head is set on the
+ * first element of every run of equivalent keys, count is the number of
+ * runs started so far and value the scan of the current run so far.
+ */
+template <typename T>
+struct key_segment {
+  bool head;
+  std::size_t count;
+  T value;
+};
+
+/* key_segment_combine.
+ * Segmented version of op: the values are not combined across a head.
+ * The operation is associative whenever op is.
+ */
+template <typename T, typename BinaryOperation>
+key_segment<T> key_segment_combine(key_segment<T> a, key_segment<T> b,
+                                   BinaryOperation op) {
+  return key_segment<T>{a.head || b.head, a.count + b.count,
+                        b.head ? b.value : op(a.value, b.value)};
+}
+
+/* buffer_segmented_scan.
+ * Inclusive scan with op of the n first values of values_buff, restarted on
+ * every run of consecutive keys of keys_buff equivalent with respect to pred.
+ * The runs are delimited on the device with head flags, carried by the
+ * operation of a single buffer_mapscan over all the runs. Returns the
+ * scanned segments, so that the caller can write its output from them.
+ */
+template <typename T, typename ExecutionPolicy, typename KeyBuffer,
+          typename ValueBuffer, typename BinaryPredicate,
+          typename BinaryOperation>
+cl::sycl::buffer<key_segment<T>, 1> buffer_segmented_scan(
+    ExecutionPolicy &snp, cl::sycl::queue q, KeyBuffer keys_buff,
+    ValueBuffer values_buff, std::size_t n, BinaryPredicate pred,
+    BinaryOperation op) {
+  using S = key_segment<T>;
+  auto segment_buff = sycl::helpers::make_temp_buffer<S>(n);
+
+  // Head flags: a run starts where the key is not equivalent to the previous
+  q.submit([&](cl::sycl::handler &h) {
+    auto keys = keys_buff.template get_access<cl::sycl::access::mode::read>(h);
+    auto values =
+        values_buff.template get_access<cl::sycl::access::mode::read>(h);
+    auto segments =
+        segment_buff.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<
+        cl::sycl::helpers::NameGen<2, typename ExecutionPolicy::kernelName>>(
+        cl::sycl::range<1>{n}, [=](cl::sycl::item<1> it) {
+          const std::size_t pos = it.get_linear_id();
+          const bool head = pos == 0 || !pred(keys[pos - 1], keys[pos]);
+          segments[pos] = S{head, head ? std::size_t(1) : std::size_t(0),
+                            T(values[pos])};
+        });
+  });
+
+  // Segmented scan, the value of init is never used as the first element
+  // is always a head
+  auto d = compute_mapscan_descriptor(q.get_device(), n, sizeof(S));
+  buffer_mapscan(snp, q, segment_buff, segment_buff, S{false, 0, T{}}, d,
+                 [](S x) { return x; },
+                 [op](S x, S y) { return key_segment_combine(x, y, op); });
+  return segment_buff;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_SEGMENTED_SCAN__
@@ -32,6 +32,12 @@
 #include <type_traits>
 #include <typeinfo>
 #include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_future.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
 
 /** sort_kernel_bitonic.
  * Class used to name the bitonic kernel sort per type.
@@ -39,11 +45,49 @@
 template <typename T>
 class sort_kernel_bitonic;
 
-/** sequential_sort_name.
- * Class used to name the bitonic kernel sort per type.
+/** sort_kernel_merge.
+ * Class used to name the merge sort kernels per type.
+ */
+template <typename T>
+class sort_kernel_merge;
+
+/** merge_sort_name.
+ * Class used to name the merge sort kernels per type.
+ */
+template <typename T>
+class merge_sort_name {
+  T userGivenKernelName;
+};
+
+/** sort_by_key_name.
+ * Class used to name the sort_by_key kernels.
+ */
+template <typename T>
+class sort_by_key_name {
+  T userGivenKernelName;
+};
+
+/** segmented_sort_name.
+ * Class used to name the segmented_sort kernels.
+ */
+template <typename T>
+class segmented_sort_name {
+  T userGivenKernelName;
+};
+
+/** partial_sort_name.
+ * Class used to name the partial_sort and partial_sort_copy kernels.
+ */
+template <typename T>
+class partial_sort_name {
+  T userGivenKernelName;
+};
+
+/** nth_element_name.
+ * Class used to name the nth_element kernels.
  */
 template <typename T>
-class sequential_sort_name {
+class nth_element_name {
   T userGivenKernelName;
 };
 
@@ -55,281 +99,2232 @@ class bitonic_sort_name {
   T userGivenKernelName;
 };
 
-/* sort_swap.
- * Basic simple swap used inside the sort functions.
+/* radix_sort_bits.
+ * Number of bits of the key consumed by each pass of the radix sort.
+ */
+constexpr int radix_sort_bits = 4;
+
+/* radix_sort_radix.
+ * Number of buckets (i.e. distinct digits) of each radix sort pass.
+ */
+constexpr int radix_sort_radix = 1 << radix_sort_bits;
+
+/* radix_sort_key.
+ * Maps an arithmetic value onto an unsigned integer of the same size whose
+ * natural ordering is the ordering of the original values, so that the
+ * radix sort only needs to deal with unsigned digits.
+ */
+template <typename T, typename Enable = void>
+struct radix_sort_key;
+
+template <typename T>
+struct radix_sort_key<
+    T, typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_unsigned<T>::value>::type> {
+  typedef T bits_type;
+
+  static bits_type get(T value) { return value; }
+};
+
+template <typename T>
+struct radix_sort_key<
+    T, typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_signed<T>::value>::type> {
+  typedef typename std::make_unsigned<T>::type bits_type;
+
+  // Flipping the sign bit moves the negative values below the positive ones
+  static bits_type get(T value) {
+    return static_cast<bits_type>(value) ^
+           (bits_type(1) << (sizeof(bits_type) * 8 - 1));
+  }
+};
+
+template <typename T>
+struct radix_sort_key<
+    T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type
+      bits_type;
+
+  // Positive values only need the sign bit flipped, negative values have all
+  // their bits flipped so that larger magnitudes sort first
+  static bits_type get(T value) {
+    union {
+      T value;
+      bits_type bits;
+    } u;
+    u.value = value;
+    const bits_type signBit = bits_type(1) << (sizeof(bits_type) * 8 - 1);
+    return (u.bits & signBit) ? ~u.bits : (u.bits ^ signBit);
+  }
+};
+
+/* radix_sort_digit.
+ * Returns the digit of the given value used by the pass starting at shift.
  */
 template <typename T>
-void sort_swap(T &lhs, T &rhs) {
-  auto temp = rhs;
-  rhs = lhs;
-  lhs = temp;
+inline int radix_sort_digit(T value, int shift) {
+  return static_cast<int>((radix_sort_key<T>::get(value) >> shift) &
+                          (radix_sort_radix - 1));
 }
 
-/* sort_kernel_sequential.
- * Simple kernel to sequentially sort a vector
+/* radix_sort_digit_op.
+ * Digit of the values used by the radix sort pass starting at shift.
+ */
+template <typename T>
+struct radix_sort_digit_op {
+  int shift_;
+
+  radix_sort_digit_op(int shift) : shift_(shift){};
+
+  int operator()(T value) const { return radix_sort_digit(value, shift_); }
+};
+
+/* radix_select_partition_op.
+ * Digit used to partition the values around the key of a selected element:
+ * 0 for the lesser values, 1 for the equal ones and 2 for the greater ones.
  */
 template <typename T>
-class sort_kernel_sequential {
+struct radix_select_partition_op {
+  typedef typename radix_sort_key<T>::bits_type bits_type;
+
+  bits_type pivot_;
+
+  radix_select_partition_op(bits_type pivot) : pivot_(pivot){};
+
+  int operator()(T value) const {
+    const bits_type key = radix_sort_key<T>::get(value);
+    return (key < pivot_) ? 0 : ((key == pivot_) ? 1 : 2);
+  }
+};
+
+/* radix_sort_tile_scan.
+ * Inclusive scan, across the work-items of a work-group, of the per
+ * work-item digit counts stored in scratch (one row of nbWorkItem counters
+ * per digit).
+ */
+template <typename LocalAccessor>
+inline void radix_sort_tile_scan(LocalAccessor scratch, size_t localId,
+                                 size_t nbWorkItem, cl::sycl::nd_item<1> id) {
+  for (size_t offset = 1; offset < nbWorkItem; offset <<= 1) {
+    unsigned int partial[radix_sort_radix];
+    for (int d = 0; d < radix_sort_radix; d++) {
+      partial[d] =
+          (localId >= offset) ? scratch[d * nbWorkItem + localId - offset] : 0;
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+    for (int d = 0; d < radix_sort_radix; d++) {
+      scratch[d * nbWorkItem + localId] += partial[d];
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+  }
+}
+
+/* radix_sort_count_kernel.
+ * Computes the histogram of the digits of each tile of the input.
+ * The histogram is stored digit-major (hist[digit * nbTiles + tile]), so
+ * that its exclusive scan gives the position of the first element of each
+ * digit of each tile in the output of the pass.
+ */
+template <typename T, class DigitOp = radix_sort_digit_op<T>>
+class radix_sort_count_kernel {
   /* Aliases for SYCL accessors */
-  using sycl_rw_acc =
-      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
                          cl::sycl::access::target::global_buffer>;
+  using sycl_hist_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
 
-  sycl_rw_acc a_;
+  sycl_r_acc in_;
+  sycl_hist_acc hist_;
+  sycl_local_acc scratch_;
   size_t vS_;
+  size_t sizePerWorkItem_;
+  DigitOp digit_;
 
  public:
-  sort_kernel_sequential(sycl_rw_acc a, size_t vectorSize)
-      : a_(a), vS_(vectorSize){};
-
-  // Simple sequential sort
-  void operator()() {
-    for (size_t i = 0; i < vS_; i++) {
-      for (size_t j = 1; j < vS_; j++) {
-        if (a_[j - 1] > a_[j]) {
-          sort_swap<T>(a_[j - 1], a_[j]);
-        }
-      }
+  radix_sort_count_kernel(sycl_r_acc in, sycl_hist_acc hist,
+                          sycl_local_acc scratch, size_t vectorSize,
+                          size_t sizePerWorkItem, DigitOp digit)
+      : in_(in),
+        hist_(hist),
+        scratch_(scratch),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        digit_(digit){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+    const size_t tile = id.get_group(0);
+    const size_t nbTiles = id.get_group_range(0);
+    // each work-item counts a contiguous chunk of its tile
+    const size_t begin = (tile * nbWorkItem + localId) * sizePerWorkItem_;
+    const size_t end = (begin + sizePerWorkItem_ < vS_)
+                           ? begin + sizePerWorkItem_
+                           : vS_;
+
+    unsigned int counts[radix_sort_radix];
+    for (int d = 0; d < radix_sort_radix; d++) {
+      counts[d] = 0;
+    }
+    for (size_t i = begin; i < end; i++) {
+      counts[digit_(in_[i])]++;
+    }
+    for (int d = 0; d < radix_sort_radix; d++) {
+      scratch_[d * nbWorkItem + localId] = counts[d];
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    radix_sort_tile_scan(scratch_, localId, nbWorkItem, id);
+
+    for (size_t d = localId; d < size_t(radix_sort_radix); d += nbWorkItem) {
+      hist_[d * nbTiles + tile] = scratch_[d * nbWorkItem + nbWorkItem - 1];
     }
   }
-};  // class sort_kernel
+};  // class radix_sort_count_kernel
 
-/* sort_kernel_sequential.
- * Simple kernel to sequentially sort a vector
+/* radix_sort_scan_kernel.
+ * Exclusive scan of the histogram, performed by a single work-group.
+ * Each work-item sums a contiguous chunk of the histogram, the partial sums
+ * are scanned in local memory and then each work-item writes its chunk back.
  */
-template <typename T, class ComparableOperator>
-class sort_kernel_sequential_comp {
+class radix_sort_scan_kernel {
   /* Aliases for SYCL accessors */
-  using sycl_rw_acc =
-      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+  using sycl_hist_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
                          cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
 
-  sycl_rw_acc a_;
+  sycl_hist_acc hist_;
+  sycl_local_acc scratch_;
+  size_t hS_;
+
+ public:
+  radix_sort_scan_kernel(sycl_hist_acc hist, sycl_local_acc scratch,
+                         size_t histSize)
+      : hist_(hist), scratch_(scratch), hS_(histSize){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+    const size_t chunk = (hS_ + nbWorkItem - 1) / nbWorkItem;
+    const size_t begin = localId * chunk;
+    const size_t end = (begin + chunk < hS_) ? begin + chunk : hS_;
+
+    size_t sum = 0;
+    for (size_t i = begin; i < end; i++) {
+      sum += hist_[i];
+    }
+    scratch_[localId] = sum;
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (size_t offset = 1; offset < nbWorkItem; offset <<= 1) {
+      size_t partial = (localId >= offset) ? scratch_[localId - offset] : 0;
+      id.barrier(cl::sycl::access::fence_space::local_space);
+      scratch_[localId] += partial;
+      id.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    size_t acc = scratch_[localId] - sum;
+    for (size_t i = begin; i < end; i++) {
+      size_t count = hist_[i];
+      hist_[i] = acc;
+      acc += count;
+    }
+  }
+};  // class radix_sort_scan_kernel
+
+/* radix_sort_scatter_kernel.
+ * Moves every element of a tile to its position in the output of the pass.
+ * Elements with the same digit keep their relative order, which is what
+ * makes the successive passes of the LSD radix sort correct.
+ */
+template <typename T, class DigitOp = radix_sort_digit_op<T>>
+class radix_sort_scatter_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_w_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_hist_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_r_acc in_;
+  sycl_w_acc out_;
+  sycl_hist_acc hist_;
+  sycl_local_acc scratch_;
   size_t vS_;
-  ComparableOperator comp_;
+  size_t sizePerWorkItem_;
+  DigitOp digit_;
 
  public:
-  sort_kernel_sequential_comp(sycl_rw_acc a, size_t vectorSize,
-                              ComparableOperator comp)
-      : a_(a), vS_(vectorSize), comp_(comp){};
-
-  // Simple sequential sort
-  void operator()() {
-    for (size_t i = 0; i < vS_; i++) {
-      for (size_t j = 1; j < vS_; j++) {
-        if (comp_(a_[j - 1], a_[j])) {
-          sort_swap<T>(a_[j - 1], a_[j]);
-        }
-      }
+  radix_sort_scatter_kernel(sycl_r_acc in, sycl_w_acc out, sycl_hist_acc hist,
+                            sycl_local_acc scratch, size_t vectorSize,
+                            size_t sizePerWorkItem, DigitOp digit)
+      : in_(in),
+        out_(out),
+        hist_(hist),
+        scratch_(scratch),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        digit_(digit){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+    const size_t tile = id.get_group(0);
+    const size_t nbTiles = id.get_group_range(0);
+    const size_t begin = (tile * nbWorkItem + localId) * sizePerWorkItem_;
+    const size_t end = (begin + sizePerWorkItem_ < vS_)
+                           ? begin + sizePerWorkItem_
+                           : vS_;
+
+    unsigned int counts[radix_sort_radix];
+    for (int d = 0; d < radix_sort_radix; d++) {
+      counts[d] = 0;
+    }
+    for (size_t i = begin; i < end; i++) {
+      counts[digit_(in_[i])]++;
+    }
+    for (int d = 0; d < radix_sort_radix; d++) {
+      scratch_[d * nbWorkItem + localId] = counts[d];
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    radix_sort_tile_scan(scratch_, localId, nbWorkItem, id);
+
+    // first output position of each digit for this work-item
+    size_t offsets[radix_sort_radix];
+    for (int d = 0; d < radix_sort_radix; d++) {
+      offsets[d] = hist_[d * nbTiles + tile] +
+                   scratch_[d * nbWorkItem + localId] - counts[d];
+    }
+    for (size_t i = begin; i < end; i++) {
+      T value = in_[i];
+      out_[offsets[digit_(value)]++] = value;
     }
   }
-};  // class sort_kernel
+};  // class radix_sort_scatter_kernel
 
-namespace sycl {
-namespace impl {
+/* radix_select_count_kernel.
+ * Computes the histogram of the digits starting at shift of each tile of the
+ * input, like radix_sort_count_kernel, but only counts the elements whose
+ * higher digits are the ones selected so far (stored in prefix).
+ */
+template <typename T>
+class radix_select_count_kernel {
+  typedef typename radix_sort_key<T>::bits_type bits_type;
 
-/* Aliases for SYCL accessors */
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_prefix_acc =
+      cl::sycl::accessor<bits_type, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_hist_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_r_acc in_;
+  sycl_prefix_acc prefix_;
+  sycl_hist_acc hist_;
+  sycl_local_acc scratch_;
+  size_t vS_;
+  size_t sizePerWorkItem_;
+  int shift_;
+
+ public:
+  radix_select_count_kernel(sycl_r_acc in, sycl_prefix_acc prefix,
+                            sycl_hist_acc hist, sycl_local_acc scratch,
+                            size_t vectorSize, size_t sizePerWorkItem,
+                            int shift)
+      : in_(in),
+        prefix_(prefix),
+        hist_(hist),
+        scratch_(scratch),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        shift_(shift){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+    const size_t tile = id.get_group(0);
+    const size_t nbTiles = id.get_group_range(0);
+    const size_t begin = (tile * nbWorkItem + localId) * sizePerWorkItem_;
+    const size_t end = (begin + sizePerWorkItem_ < vS_)
+                           ? begin + sizePerWorkItem_
+                           : vS_;
+    // mask of the digits already selected
+    const int high = shift_ + radix_sort_bits;
+    const bits_type mask =
+        (high >= static_cast<int>(sizeof(bits_type) * 8))
+            ? bits_type(0)
+            : static_cast<bits_type>(static_cast<bits_type>(~bits_type(0))
+                                     << high);
+    const bits_type prefix = prefix_[0] & mask;
+
+    unsigned int counts[radix_sort_radix];
+    for (int d = 0; d < radix_sort_radix; d++) {
+      counts[d] = 0;
+    }
+    for (size_t i = begin; i < end; i++) {
+      const bits_type key = radix_sort_key<T>::get(in_[i]);
+      if ((key & mask) == prefix) {
+        counts[(key >> shift_) & (radix_sort_radix - 1)]++;
+      }
+    }
+    for (int d = 0; d < radix_sort_radix; d++) {
+      scratch_[d * nbWorkItem + localId] = counts[d];
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    radix_sort_tile_scan(scratch_, localId, nbWorkItem, id);
+
+    for (size_t d = localId; d < size_t(radix_sort_radix); d += nbWorkItem) {
+      hist_[d * nbTiles + tile] = scratch_[d * nbWorkItem + nbWorkItem - 1];
+    }
+  }
+};  // class radix_select_count_kernel
+
+/* radix_select_kernel.
+ * Finds, in a single work-group, the digit starting at shift of the element
+ * of rank rank[0] among the ones counted by radix_select_count_kernel, and
+ * appends it to prefix[0]. rank[0] becomes the rank of the element among the
+ * ones sharing the new prefix.
+ */
 template <typename T>
-using sycl_rw_acc = cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
-                                       cl::sycl::access::target::global_buffer>;
+class radix_select_kernel {
+  typedef typename radix_sort_key<T>::bits_type bits_type;
 
-/** isPowerOfTwo.
- * Quick check to ensure num is a power of two.
- * Will only work with integers.
- * @return true if num is power of two
+  /* Aliases for SYCL accessors */
+  using sycl_hist_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_prefix_acc =
+      cl::sycl::accessor<bits_type, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_rank_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_hist_acc hist_;
+  sycl_prefix_acc prefix_;
+  sycl_rank_acc rank_;
+  sycl_local_acc scratch_;
+  size_t nbTiles_;
+  int shift_;
+
+ public:
+  radix_select_kernel(sycl_hist_acc hist, sycl_prefix_acc prefix,
+                      sycl_rank_acc rank, sycl_local_acc scratch,
+                      size_t nbTiles, int shift)
+      : hist_(hist),
+        prefix_(prefix),
+        rank_(rank),
+        scratch_(scratch),
+        nbTiles_(nbTiles),
+        shift_(shift){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t nbWorkItem = id.get_local_range(0);
+
+    // each work-item sums the counts of a subset of the tiles
+    for (int d = 0; d < radix_sort_radix; d++) {
+      size_t sum = 0;
+      for (size_t t = localId; t < nbTiles_; t += nbWorkItem) {
+        sum += hist_[d * nbTiles_ + t];
+      }
+      scratch_[d * nbWorkItem + localId] = sum;
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    if (localId == 0) {
+      size_t rank = rank_[0];
+      for (int d = 0; d < radix_sort_radix; d++) {
+        size_t total = 0;
+        for (size_t i = 0; i < nbWorkItem; i++) {
+          total += scratch_[d * nbWorkItem + i];
+        }
+        if (rank < total) {
+          prefix_[0] = prefix_[0] |
+                       static_cast<bits_type>(static_cast<bits_type>(d)
+                                              << shift_);
+          rank_[0] = rank;
+          break;
+        }
+        rank -= total;
+      }
+    }
+  }
+};  // class radix_select_kernel
+
+/* sort_copy_kernel.
+ * Copies the first elements of a buffer into another one.
  */
 template <typename T>
-inline bool isPowerOfTwo(T num) {
-  return (num != 0) && !(num & (num - 1));
-}
+class sort_copy_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_w_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
 
-template <>
-inline bool isPowerOfTwo<float>(float num) = delete;
-template <>
-inline bool isPowerOfTwo<double>(double num) = delete;
+  sycl_r_acc in_;
+  sycl_w_acc out_;
 
-/** sequential_sort.
- * Command group to call the sequential sort kernel */
-template <typename T, typename Alloc>
-void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                     size_t vectorSize) {
-  auto f = [buf, vectorSize](cl::sycl::handler &h) mutable {
-    auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-    h.single_task(sort_kernel_sequential<T>(a, vectorSize));
-  };
-  q.submit(f);
-}
+ public:
+  sort_copy_kernel(sycl_r_acc in, sycl_w_acc out) : in_(in), out_(out){};
 
-/** sequential_sort.
- * Command group to call the sequential sort kernel */
-template <typename T, typename Alloc, class ComparableOperator, typename Name>
-void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                     size_t vectorSize, ComparableOperator comp) {
-  auto f = [buf, vectorSize, comp](cl::sycl::handler &h) mutable {
-    auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-    h.single_task<Name>(sort_kernel_sequential_comp<T, ComparableOperator>(
-        a, vectorSize, comp));
-  };
-  q.submit(f);
-}
+  void operator()(cl::sycl::item<1> it) { out_[it] = in_[it]; }
+};  // class sort_copy_kernel
 
-/* bitonic_sort.
- * Performs a bitonic sort on the given buffer
+/* sort_default_less.
+ * Ordering used by the default sort. Like the bitonic kernels, it only
+ * requires operator> on the value type.
  */
-template <typename T, typename Alloc>
-void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                  size_t vectorSize) {
-  int numStages = 0;
-  // 2^numStages should be equal to length
-  // i.e number of times you halve the lenght to get 1 should be numStages
-  for (int tmp = vectorSize; tmp > 1; tmp >>= 1) {
-    ++numStages;
-  }
-  cl::sycl::range<1> r{vectorSize / 2};
-  for (int stage = 0; stage < numStages; ++stage) {
-    // Every stage has stage + 1 passes
-    for (int passOfStage = 0; passOfStage < stage + 1; ++passOfStage) {
-      auto f = [=](cl::sycl::handler &h) mutable {
-        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-        h.parallel_for<sort_kernel_bitonic<T>>(
-            cl::sycl::range<1>{r},
-            [a, stage, passOfStage](cl::sycl::item<1> it) {
-              int sortIncreasing = 1;
-              cl::sycl::id<1> id = it.get_id();
-              int threadId = id.get(0);
-
-              int pairDistance = 1 << (stage - passOfStage);
-              int blockWidth = 2 * pairDistance;
-
-              int leftId = (threadId % pairDistance) +
-                           (threadId / pairDistance) * blockWidth;
-              int rightId = leftId + pairDistance;
-
-              T leftElement = a[leftId];
-              T rightElement = a[rightId];
-
-              int sameDirectionBlockWidth = 1 << stage;
-
-              if ((threadId / sameDirectionBlockWidth) % 2 == 1) {
-                sortIncreasing = 1 - sortIncreasing;
-              }
-
-              T greater;
-              T lesser;
-
-              if (leftElement > rightElement) {
-                greater = leftElement;
-                lesser = rightElement;
-              } else {
-                greater = rightElement;
-                lesser = leftElement;
-              }
-
-              a[leftId] = sortIncreasing ? lesser : greater;
-              a[rightId] = sortIncreasing ? greater : lesser;
-            });
-      };  // command group functor
-      q.submit(f);
-    }  // passStage
-  }    // stage
-}  // bitonic_sort
+template <typename T>
+struct sort_default_less {
+  bool operator()(const T &lhs, const T &rhs) const { return rhs > lhs; }
+};
 
-/* bitonic_sort.
- * Performs a bitonic sort on the given buffer
+/* sort_comp_less.
+ * Adapts the comparison operator given to sort, which returns true when its
+ * first argument has to be placed after the second one, to a less-than
+ * ordering.
  */
-template <typename T, typename Alloc, class ComparableOperator, typename Name>
-void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                  size_t vectorSize, ComparableOperator comp) {
-  int numStages = 0;
-  // 2^numStages should be equal to length
-  // i.e number of times you halve the lenght to get 1 should be numStages
-  for (int tmp = vectorSize; tmp > 1; tmp >>= 1) {
-    ++numStages;
-  }
-  cl::sycl::range<1> r{vectorSize / 2};
-  for (int stage = 0; stage < numStages; ++stage) {
-    // Every stage has stage + 1 passes
-    for (int passOfStage = 0; passOfStage < stage + 1; ++passOfStage) {
-      auto f = [=](cl::sycl::handler &h) mutable {
-        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-        h.parallel_for<Name>(
-            cl::sycl::range<1>{r},
-            [a, stage, passOfStage, comp](cl::sycl::item<1> it) {
-              int sortIncreasing = 1;
-              cl::sycl::id<1> id = it.get_id();
-              int threadId = id.get(0);
-
-              int pairDistance = 1 << (stage - passOfStage);
-              int blockWidth = 2 * pairDistance;
-
-              int leftId = (threadId % pairDistance) +
-                           (threadId / pairDistance) * blockWidth;
-              int rightId = leftId + pairDistance;
-
-              T leftElement = a[leftId];
-              T rightElement = a[rightId];
-
-              int sameDirectionBlockWidth = 1 << stage;
-
-              if ((threadId / sameDirectionBlockWidth) % 2 == 1) {
-                sortIncreasing = 1 - sortIncreasing;
-              }
-
-              T greater;
-              T lesser;
-
-              if (comp(leftElement, rightElement)) {
-                greater = leftElement;
-                lesser = rightElement;
-              } else {
-                greater = rightElement;
-                lesser = leftElement;
-              }
-
-              a[leftId] = sortIncreasing ? lesser : greater;
-              a[rightId] = sortIncreasing ? greater : lesser;
-            });
-      };  // command group functor
-      q.submit(f);
-    }  // passStage
-  }    // stage
-}  // bitonic_sort
+template <typename T, class ComparableOperator>
+struct sort_comp_less {
+  ComparableOperator comp_;
 
-template<typename T>
-struct buffer_traits;
+  sort_comp_less(ComparableOperator comp) : comp_(comp){};
 
-template<typename T, typename Alloc>
-struct buffer_traits<cl::sycl::buffer<T, 1, Alloc>> {
-  typedef Alloc allocator_type;
+  bool operator()(const T &lhs, const T &rhs) const { return comp_(rhs, lhs); }
 };
 
-/** sort
- * @brief Function that takes a Comp Operator and applies it to the given range
- * @param sep   : Execution Policy
- * @param first : Start of the range
- * @param last  : End of the range
- * @param comp  : Comp Operator
+/* bitonic_sort_kernel.
+ * Performs one pass of the bitonic sorting network on every row of a buffer.
+ * Rows have rowSize elements (but the last one, which may be shorter) and are
+ * sorted independently; a plain sort uses a single row.
+ * Each row is virtually padded up to the next power of two with elements
+ * greater than all the others. Every comparator of the network puts the
+ * lesser element at the lower index (the first pass of a stage compares
+ * mirrored positions of the block instead of sorting every other block in
+ * decreasing order), so a comparator that reaches into the padding would
+ * leave both elements in place and is simply skipped.
  */
-template <class ExecutionPolicy, class RandomIt, class CompareOp>
-void sort(ExecutionPolicy &sep, RandomIt first, RandomIt last, CompareOp comp) {
-  cl::sycl::queue q(sep.get_queue());
-  typedef typename std::iterator_traits<RandomIt>::value_type type_;
-  auto buf = std::move(sycl::helpers::make_buffer(first, last));
-  auto vectorSize = buf.get_count();
+template <typename T, class Less>
+class bitonic_sort_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_rw_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
 
-  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
-  
-  if (impl::isPowerOfTwo(vectorSize)) {
-    sycl::impl::bitonic_sort<
-        type_, allocator_, CompareOp,
-        bitonic_sort_name<typename ExecutionPolicy::kernelName>>(
-        q, buf, vectorSize, comp);
-  } else {
-    sycl::impl::sequential_sort<
-        type_, allocator_, CompareOp,
-        sequential_sort_name<typename ExecutionPolicy::kernelName>>(
-        q, buf, vectorSize, comp);
+  sycl_rw_acc a_;
+  size_t vS_;
+  size_t rowSize_;
+  size_t paddedRowSize_;
+  int stage_;
+  int passOfStage_;
+  Less less_;
+
+ public:
+  bitonic_sort_kernel(sycl_rw_acc a, size_t vectorSize, size_t rowSize,
+                      size_t paddedRowSize, int stage, int passOfStage,
+                      Less less)
+      : a_(a),
+        vS_(vectorSize),
+        rowSize_(rowSize),
+        paddedRowSize_(paddedRowSize),
+        stage_(stage),
+        passOfStage_(passOfStage),
+        less_(less){};
+
+  void operator()(cl::sycl::item<1> it) {
+    const size_t row = it.get_id(0) / (paddedRowSize_ / 2);
+    const size_t threadId = it.get_id(0) % (paddedRowSize_ / 2);
+    const size_t rowBegin = row * rowSize_;
+    const size_t rowLength =
+        (rowBegin + rowSize_ < vS_) ? rowSize_ : vS_ - rowBegin;
+
+    const size_t pairDistance = size_t(1) << (stage_ - passOfStage_);
+    const size_t blockWidth = 2 * pairDistance;
+    const size_t offset = threadId % pairDistance;
+
+    const size_t leftId = offset + (threadId / pairDistance) * blockWidth;
+    const size_t rightId = (passOfStage_ == 0)
+                               ? leftId + blockWidth - 1 - 2 * offset
+                               : leftId + pairDistance;
+    if (rightId >= rowLength) {
+      return;
+    }
+
+    T leftElement = a_[rowBegin + leftId];
+    T rightElement = a_[rowBegin + rightId];
+    if (less_(rightElement, leftElement)) {
+      a_[rowBegin + leftId] = rightElement;
+      a_[rowBegin + rightId] = leftElement;
+    }
   }
+};  // class bitonic_sort_kernel
+
+/* bitonic_sort_local_kernel.
+ * Performs, in local memory, all the passes of the given bitonic stages whose
+ * pair distance fits inside the tile of a work-group. Each work-item handles
+ * one comparator of every pass, so a tile holds twice as many elements as
+ * there are work-items. Tiles never span two rows. Passes with larger pair
+ * distances are performed by bitonic_sort_kernel.
+ */
+template <typename T, class Less>
+class bitonic_sort_local_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_rw_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_rw_acc a_;
+  sycl_local_acc scratch_;
+  size_t vS_;
+  size_t rowSize_;
+  size_t paddedRowSize_;
+  int tileStages_;
+  int stageBegin_;
+  int stageEnd_;
+  Less less_;
+
+ public:
+  bitonic_sort_local_kernel(sycl_rw_acc a, sycl_local_acc scratch,
+                            size_t vectorSize, size_t rowSize,
+                            size_t paddedRowSize, int tileStages,
+                            int stageBegin, int stageEnd, Less less)
+      : a_(a),
+        scratch_(scratch),
+        vS_(vectorSize),
+        rowSize_(rowSize),
+        paddedRowSize_(paddedRowSize),
+        tileStages_(tileStages),
+        stageBegin_(stageBegin),
+        stageEnd_(stageEnd),
+        less_(less){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t halfTile = id.get_local_range(0);
+    const size_t tilesPerRow = paddedRowSize_ / (2 * halfTile);
+    const size_t row = id.get_group(0) / tilesPerRow;
+    const size_t rowBegin = row * rowSize_;
+    const size_t rowLength =
+        (rowBegin + rowSize_ < vS_) ? rowSize_ : vS_ - rowBegin;
+    // position of the tile in the row
+    const size_t tileBegin = (id.get_group(0) % tilesPerRow) * 2 * halfTile;
+
+    if (tileBegin + localId < rowLength) {
+      scratch_[localId] = a_[rowBegin + tileBegin + localId];
+    }
+    if (tileBegin + localId + halfTile < rowLength) {
+      scratch_[localId + halfTile] =
+          a_[rowBegin + tileBegin + localId + halfTile];
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (int stage = stageBegin_; stage < stageEnd_; ++stage) {
+      // Skip the passes already done in global memory
+      const int firstPass =
+          (stage >= tileStages_) ? stage - tileStages_ + 1 : 0;
+      for (int passOfStage = firstPass; passOfStage < stage + 1;
+           ++passOfStage) {
+        const size_t pairDistance = size_t(1) << (stage - passOfStage);
+        const size_t blockWidth = 2 * pairDistance;
+        const size_t offset = localId % pairDistance;
+
+        const size_t leftId = offset + (localId / pairDistance) * blockWidth;
+        const size_t rightId = (passOfStage == 0)
+                                   ? leftId + blockWidth - 1 - 2 * offset
+                                   : leftId + pairDistance;
+        if (tileBegin + rightId < rowLength) {
+          T leftElement = scratch_[leftId];
+          T rightElement = scratch_[rightId];
+          if (less_(rightElement, leftElement)) {
+            scratch_[leftId] = rightElement;
+            scratch_[rightId] = leftElement;
+          }
+        }
+        id.barrier(cl::sycl::access::fence_space::local_space);
+      }
+    }
+
+    if (tileBegin + localId < rowLength) {
+      a_[rowBegin + tileBegin + localId] = scratch_[localId];
+    }
+    if (tileBegin + localId + halfTile < rowLength) {
+      a_[rowBegin + tileBegin + localId + halfTile] =
+          scratch_[localId + halfTile];
+    }
+  }
+};  // class bitonic_sort_local_kernel
+
+/* merge_path_split.
+ * Returns how many elements of the sorted run A = acc[aBegin, aBegin + aSize)
+ * are among the first diag elements of the stable merge of A with the sorted
+ * run B = acc[bBegin, bBegin + bSize).
+ */
+template <typename Accessor, class Less>
+inline size_t merge_path_split(const Accessor &acc, size_t aBegin,
+                               size_t aSize, size_t bBegin, size_t bSize,
+                               size_t diag, Less less) {
+  size_t lo = (diag > bSize) ? diag - bSize : 0;
+  size_t hi = (diag < aSize) ? diag : aSize;
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    // elements of A are taken first on ties, which keeps the merge stable
+    if (!less(acc[bBegin + diag - mid - 1], acc[aBegin + mid])) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/* merge_path_merge.
+ * Writes the elements [diag, diag + count) of the stable merge of the runs
+ * A = in[aBegin, aBegin + aSize) and B = in[bBegin, bBegin + bSize) to
+ * out[outBegin, outBegin + count).
+ */
+template <typename InAccessor, typename OutAccessor, class Less>
+inline void merge_path_merge(const InAccessor &in, size_t aBegin, size_t aSize,
+                             size_t bBegin, size_t bSize, size_t diag,
+                             size_t count, const OutAccessor &out,
+                             size_t outBegin, Less less) {
+  size_t i = merge_path_split(in, aBegin, aSize, bBegin, bSize, diag, less);
+  size_t j = diag - i;
+  for (size_t k = 0; k < count; k++) {
+    if (j >= bSize || (i < aSize && !less(in[bBegin + j], in[aBegin + i]))) {
+      out[outBegin + k] = in[aBegin + i];
+      i++;
+    } else {
+      out[outBegin + k] = in[bBegin + j];
+      j++;
+    }
+  }
+}
+
+/* merge_sort_tile_kernel.
+ * Sorts each tile of the buffer in local memory.
+ * Every work-item first sorts its own chunk with an insertion sort, then the
+ * sorted chunks are merged pairwise, each work-item producing a chunk of the
+ * merged runs, until the whole tile is sorted.
+ */
+template <typename T, class Less>
+class merge_sort_tile_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_rw_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_local_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_rw_acc a_;
+  sycl_local_acc scratch1_;
+  sycl_local_acc scratch2_;
+  size_t vS_;
+  size_t sizePerWorkItem_;
+  Less less_;
+
+ public:
+  merge_sort_tile_kernel(sycl_rw_acc a, sycl_local_acc scratch1,
+                         sycl_local_acc scratch2, size_t vectorSize,
+                         size_t sizePerWorkItem, Less less)
+      : a_(a),
+        scratch1_(scratch1),
+        scratch2_(scratch2),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        less_(less){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t tileSize = id.get_local_range(0) * sizePerWorkItem_;
+    const size_t tileBegin = id.get_group(0) * tileSize;
+    const size_t tileEnd =
+        (tileBegin + tileSize < vS_) ? tileBegin + tileSize : vS_;
+    const size_t validSize = tileEnd - tileBegin;
+    const size_t chunkBegin = localId * sizePerWorkItem_;
+    const size_t chunkEnd = (chunkBegin + sizePerWorkItem_ < validSize)
+                                ? chunkBegin + sizePerWorkItem_
+                                : validSize;
+
+    // Load and sort the chunk of the work-item
+    for (size_t i = chunkBegin; i < chunkEnd; i++) {
+      T value = a_[tileBegin + i];
+      size_t j = i;
+      for (; j > chunkBegin && less_(value, scratch1_[j - 1]); j--) {
+        scratch1_[j] = scratch1_[j - 1];
+      }
+      scratch1_[j] = value;
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    // Merge the sorted runs until the tile is sorted
+    bool inFirst = true;
+    for (size_t width = sizePerWorkItem_; width < tileSize; width *= 2) {
+      const size_t aBegin = (chunkBegin / (2 * width)) * (2 * width);
+      if (chunkBegin < chunkEnd) {
+        const size_t aSize =
+            (aBegin + width < validSize) ? width : validSize - aBegin;
+        const size_t bSize = (aBegin + 2 * width < validSize)
+                                 ? width
+                                 : validSize - aBegin - aSize;
+        if (inFirst) {
+          merge_path_merge(scratch1_, aBegin, aSize, aBegin + aSize, bSize,
+                           chunkBegin - aBegin, chunkEnd - chunkBegin,
+                           scratch2_, chunkBegin, less_);
+        } else {
+          merge_path_merge(scratch2_, aBegin, aSize, aBegin + aSize, bSize,
+                           chunkBegin - aBegin, chunkEnd - chunkBegin,
+                           scratch1_, chunkBegin, less_);
+        }
+      }
+      inFirst = !inFirst;
+      id.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    for (size_t i = chunkBegin; i < chunkEnd; i++) {
+      a_[tileBegin + i] = inFirst ? scratch1_[i] : scratch2_[i];
+    }
+  }
+};  // class merge_sort_tile_kernel
+
+/* merge_sort_merge_kernel.
+ * Merges pairs of consecutive sorted runs of the given width.
+ * Each work-item finds where its chunk of the output starts in both runs
+ * with a merge path search and then merges it sequentially.
+ */
+template <typename T, class Less>
+class merge_sort_merge_kernel {
+  /* Aliases for SYCL accessors */
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  using sycl_w_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+
+  sycl_r_acc in_;
+  sycl_w_acc out_;
+  size_t vS_;
+  size_t sizePerWorkItem_;
+  size_t width_;
+  Less less_;
+
+ public:
+  merge_sort_merge_kernel(sycl_r_acc in, sycl_w_acc out, size_t vectorSize,
+                          size_t sizePerWorkItem, size_t width, Less less)
+      : in_(in),
+        out_(out),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        width_(width),
+        less_(less){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t outBegin = id.get_global_id(0) * sizePerWorkItem_;
+    if (outBegin >= vS_) {
+      return;
+    }
+    const size_t aBegin = (outBegin / (2 * width_)) * (2 * width_);
+    const size_t aSize = (aBegin + width_ < vS_) ? width_ : vS_ - aBegin;
+    const size_t bSize =
+        (aBegin + 2 * width_ < vS_) ? width_ : vS_ - aBegin - aSize;
+    const size_t count = (outBegin + sizePerWorkItem_ < vS_)
+                             ? sizePerWorkItem_
+                             : vS_ - outBegin;
+    merge_path_merge(in_, aBegin, aSize, aBegin + aSize, bSize,
+                     outBegin - aBegin, count, out_, outBegin, less_);
+  }
+};  // class merge_sort_merge_kernel
+
+/* merge_path_merge_by_key.
+ * Same as merge_path_merge, moving the values of the runs along with their
+ * keys. Only the keys are compared.
+ */
+template <typename InKeyAccessor, typename InValueAccessor,
+          typename OutKeyAccessor, typename OutValueAccessor, class Less>
+inline void merge_path_merge_by_key(
+    const InKeyAccessor &inKeys, const InValueAccessor &inValues,
+    size_t aBegin, size_t aSize, size_t bBegin, size_t bSize, size_t diag,
+    size_t count, const OutKeyAccessor &outKeys,
+    const OutValueAccessor &outValues, size_t outBegin, Less less) {
+  size_t i = merge_path_split(inKeys, aBegin, aSize, bBegin, bSize, diag, less);
+  size_t j = diag - i;
+  for (size_t k = 0; k < count; k++) {
+    if (j >= bSize ||
+        (i < aSize && !less(inKeys[bBegin + j], inKeys[aBegin + i]))) {
+      outKeys[outBegin + k] = inKeys[aBegin + i];
+      outValues[outBegin + k] = inValues[aBegin + i];
+      i++;
+    } else {
+      outKeys[outBegin + k] = inKeys[bBegin + j];
+      outValues[outBegin + k] = inValues[bBegin + j];
+      j++;
+    }
+  }
+}
+
+/* merge_sort_by_key_tile_kernel.
+ * Same as merge_sort_tile_kernel, sorting a buffer of values along with the
+ * buffer of keys.
+ */
+template <typename K, typename V, class Less>
+class merge_sort_by_key_tile_kernel {
+  /* Aliases for SYCL accessors */
+  template <typename T>
+  using sycl_rw_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::global_buffer>;
+  template <typename T>
+  using sycl_local_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>;
+
+  sycl_rw_acc<K> keys_;
+  sycl_rw_acc<V> values_;
+  sycl_local_acc<K> keys1_;
+  sycl_local_acc<K> keys2_;
+  sycl_local_acc<V> values1_;
+  sycl_local_acc<V> values2_;
+  size_t vS_;
+  size_t sizePerWorkItem_;
+  Less less_;
+
+ public:
+  merge_sort_by_key_tile_kernel(sycl_rw_acc<K> keys, sycl_rw_acc<V> values,
+                                sycl_local_acc<K> keys1,
+                                sycl_local_acc<K> keys2,
+                                sycl_local_acc<V> values1,
+                                sycl_local_acc<V> values2, size_t vectorSize,
+                                size_t sizePerWorkItem, Less less)
+      : keys_(keys),
+        values_(values),
+        keys1_(keys1),
+        keys2_(keys2),
+        values1_(values1),
+        values2_(values2),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        less_(less){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t localId = id.get_local_id(0);
+    const size_t tileSize = id.get_local_range(0) * sizePerWorkItem_;
+    const size_t tileBegin = id.get_group(0) * tileSize;
+    const size_t tileEnd =
+        (tileBegin + tileSize < vS_) ? tileBegin + tileSize : vS_;
+    const size_t validSize = tileEnd - tileBegin;
+    const size_t chunkBegin = localId * sizePerWorkItem_;
+    const size_t chunkEnd = (chunkBegin + sizePerWorkItem_ < validSize)
+                                ? chunkBegin + sizePerWorkItem_
+                                : validSize;
+
+    // Load and sort the chunk of the work-item
+    for (size_t i = chunkBegin; i < chunkEnd; i++) {
+      K key = keys_[tileBegin + i];
+      V value = values_[tileBegin + i];
+      size_t j = i;
+      for (; j > chunkBegin && less_(key, keys1_[j - 1]); j--) {
+        keys1_[j] = keys1_[j - 1];
+        values1_[j] = values1_[j - 1];
+      }
+      keys1_[j] = key;
+      values1_[j] = value;
+    }
+    id.barrier(cl::sycl::access::fence_space::local_space);
+
+    // Merge the sorted runs until the tile is sorted
+    bool inFirst = true;
+    for (size_t width = sizePerWorkItem_; width < tileSize; width *= 2) {
+      const size_t aBegin = (chunkBegin / (2 * width)) * (2 * width);
+      if (chunkBegin < chunkEnd) {
+        const size_t aSize =
+            (aBegin + width < validSize) ? width : validSize - aBegin;
+        const size_t bSize = (aBegin + 2 * width < validSize)
+                                 ? width
+                                 : validSize - aBegin - aSize;
+        if (inFirst) {
+          merge_path_merge_by_key(keys1_, values1_, aBegin, aSize,
+                                  aBegin + aSize, bSize, chunkBegin - aBegin,
+                                  chunkEnd - chunkBegin, keys2_, values2_,
+                                  chunkBegin, less_);
+        } else {
+          merge_path_merge_by_key(keys2_, values2_, aBegin, aSize,
+                                  aBegin + aSize, bSize, chunkBegin - aBegin,
+                                  chunkEnd - chunkBegin, keys1_, values1_,
+                                  chunkBegin, less_);
+        }
+      }
+      inFirst = !inFirst;
+      id.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    for (size_t i = chunkBegin; i < chunkEnd; i++) {
+      keys_[tileBegin + i] = inFirst ? keys1_[i] : keys2_[i];
+      values_[tileBegin + i] = inFirst ? values1_[i] : values2_[i];
+    }
+  }
+};  // class merge_sort_by_key_tile_kernel
+
+/* merge_sort_by_key_merge_kernel.
+ * Same as merge_sort_merge_kernel, moving the values along with the keys.
+ */
+template <typename K, typename V, class Less>
+class merge_sort_by_key_merge_kernel {
+  /* Aliases for SYCL accessors */
+  template <typename T>
+  using sycl_r_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read,
+                         cl::sycl::access::target::global_buffer>;
+  template <typename T>
+  using sycl_w_acc =
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::write,
+                         cl::sycl::access::target::global_buffer>;
+
+  sycl_r_acc<K> inKeys_;
+  sycl_r_acc<V> inValues_;
+  sycl_w_acc<K> outKeys_;
+  sycl_w_acc<V> outValues_;
+  size_t vS_;
+  size_t sizePerWorkItem_;
+  size_t width_;
+  Less less_;
+
+ public:
+  merge_sort_by_key_merge_kernel(sycl_r_acc<K> inKeys, sycl_r_acc<V> inValues,
+                                 sycl_w_acc<K> outKeys,
+                                 sycl_w_acc<V> outValues, size_t vectorSize,
+                                 size_t sizePerWorkItem, size_t width,
+                                 Less less)
+      : inKeys_(inKeys),
+        inValues_(inValues),
+        outKeys_(outKeys),
+        outValues_(outValues),
+        vS_(vectorSize),
+        sizePerWorkItem_(sizePerWorkItem),
+        width_(width),
+        less_(less){};
+
+  void operator()(cl::sycl::nd_item<1> id) {
+    const size_t outBegin = id.get_global_id(0) * sizePerWorkItem_;
+    if (outBegin >= vS_) {
+      return;
+    }
+    const size_t aBegin = (outBegin / (2 * width_)) * (2 * width_);
+    const size_t aSize = (aBegin + width_ < vS_) ? width_ : vS_ - aBegin;
+    const size_t bSize =
+        (aBegin + 2 * width_ < vS_) ? width_ : vS_ - aBegin - aSize;
+    const size_t count = (outBegin + sizePerWorkItem_ < vS_)
+                             ? sizePerWorkItem_
+                             : vS_ - outBegin;
+    merge_path_merge_by_key(inKeys_, inValues_, aBegin, aSize, aBegin + aSize,
+                            bSize, outBegin - aBegin, count, outKeys_,
+                            outValues_, outBegin, less_);
+  }
+};  // class merge_sort_by_key_merge_kernel
+
+namespace sycl {
+namespace impl {
+
+/* Aliases for SYCL accessors */
+template <typename T>
+using sycl_rw_acc = cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                                       cl::sycl::access::target::global_buffer>;
+
+/** isPowerOfTwo.
+ * Quick check to ensure num is a power of two.
+ * Will only work with integers.
+ * @return true if num is power of two
+ */
+template <typename T>
+inline bool isPowerOfTwo(T num) {
+  return (num != 0) && !(num & (num - 1));
+}
+
+template <>
+inline bool isPowerOfTwo<float>(float num) = delete;
+template <>
+inline bool isPowerOfTwo<double>(double num) = delete;
+
+/*
+ * Compute the tiling used by the local passes of bitonic_sort.
+ * Each work-item handles two elements of the tile, which must fit in local
+ * memory. The tile size is a power of two not greater than the padded size.
+ */
+inline sycl_algorithm_descriptor compute_bitonic_sort_descriptor(
+    cl::sycl::device device, size_t paddedSize, size_t sizeofT) {
+  using std::min;
+  const auto properties = sycl::helpers::get_device_properties(device);
+  const auto max_work_item = properties.max_work_item;
+  size_t local_mem_size = properties.local_mem_size;
+
+  size_t max_size_per_work_group =
+      min(min(2 * max_work_item, local_mem_size / sizeofT), paddedSize);
+  size_t size_per_work_group = 1;
+  while (2 * size_per_work_group <= max_size_per_work_group) {
+    size_per_work_group *= 2;
+  }
+
+  size_t nb_work_item = size_per_work_group / 2;
+  size_t nb_work_group = paddedSize / size_per_work_group;
+
+  return sycl_algorithm_descriptor{paddedSize, size_per_work_group, 2,
+                                   nb_work_group, nb_work_item};
+}
+
+/* bitonic_sort_local_passes.
+ * Performs in local memory the passes of the stages [stageBegin, stageEnd)
+ * whose pair distance fits in a tile, on every row.
+ */
+template <typename T, class Less, typename Name, typename Buffer>
+void bitonic_sort_local_passes(cl::sycl::queue q, Buffer buf,
+                               size_t vectorSize, size_t rowSize,
+                               size_t nbRows,
+                               const sycl_algorithm_descriptor &d,
+                               int tileStages, int stageBegin, int stageEnd,
+                               Less less) {
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        scratch(cl::sycl::range<1>{d.size_per_work_group}, h);
+    h.parallel_for<cl::sycl::helpers::NameGen<1, Name>>(
+        cl::sycl::nd_range<1>{
+            cl::sycl::range<1>{nbRows * d.nb_work_group * d.nb_work_item},
+            cl::sycl::range<1>{d.nb_work_item}},
+        bitonic_sort_local_kernel<T, Less>(a, scratch, vectorSize, rowSize,
+                                           d.size, tileStages, stageBegin,
+                                           stageEnd, less));
+  });
+}
+
+/* bitonic_sort_rows.
+ * Performs a bitonic sort on every row of rowSize elements of the given
+ * buffer (the last row may be shorter), for any row size.
+ * The rows are not padded in memory, the kernels skip the comparators that
+ * reach past their end instead.
+ * All the passes whose pair distance fits in the tile of a work-group are
+ * fused into a single kernel working in local memory: the first stages sort
+ * every tile, and each later stage only goes through global memory for its
+ * larger strides. Rows that fit in a tile are thus sorted by a single kernel.
+ */
+template <typename T, typename Alloc, class Less, typename Name>
+void bitonic_sort_rows(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                       size_t vectorSize, size_t rowSize, Less less) {
+  if (vectorSize < 2 || rowSize < 2) {
+    return;
+  }
+  int numStages = 0;
+  // 2^numStages is the smallest power of two not lower than rowSize
+  for (size_t tmp = 1; tmp < rowSize; tmp <<= 1) {
+    ++numStages;
+  }
+  const size_t paddedRowSize = size_t(1) << numStages;
+  const size_t nbRows = up_rounded_division(vectorSize, rowSize);
+  const auto d =
+      compute_bitonic_sort_descriptor(q.get_device(), paddedRowSize, sizeof(T));
+  int tileStages = 0;
+  for (size_t tmp = d.size_per_work_group; tmp > 1; tmp >>= 1) {
+    ++tileStages;
+  }
+
+  if (tileStages > 0) {
+    bitonic_sort_local_passes<T, Less, Name>(q, buf, vectorSize, rowSize,
+                                             nbRows, d, tileStages, 0,
+                                             tileStages, less);
+  }
+
+  cl::sycl::range<1> r{nbRows * paddedRowSize / 2};
+  for (int stage = tileStages; stage < numStages; ++stage) {
+    // Every stage has stage + 1 passes, the ones with a pair distance
+    // smaller than the tile are done in local memory
+    for (int passOfStage = 0; passOfStage <= stage - tileStages;
+         ++passOfStage) {
+      auto f = [=](cl::sycl::handler &h) mutable {
+        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+        h.parallel_for<Name>(
+            r, bitonic_sort_kernel<T, Less>(a, vectorSize, rowSize,
+                                            paddedRowSize, stage, passOfStage,
+                                            less));
+      };  // command group functor
+      q.submit(f);
+    }  // passStage
+    if (tileStages > 0) {
+      bitonic_sort_local_passes<T, Less, Name>(q, buf, vectorSize, rowSize,
+                                               nbRows, d, tileStages, stage,
+                                               stage + 1, less);
+    }
+  }  // stage
+}  // bitonic_sort_rows
+
+/* bitonic_sort.
+ * Performs a bitonic sort on the given buffer, for any size.
+ */
+template <typename T, typename Alloc, class Less, typename Name>
+void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t vectorSize, Less less) {
+  bitonic_sort_rows<T, Alloc, Less, Name>(q, buf, vectorSize, vectorSize,
+                                          less);
+}
+
+/* bitonic_sort.
+ * Performs a bitonic sort on the given buffer with the default comparison.
+ */
+template <typename T, typename Alloc>
+void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t vectorSize) {
+  bitonic_sort<T, Alloc, sort_default_less<T>, sort_kernel_bitonic<T>>(
+      q, buf, vectorSize, sort_default_less<T>());
+}
+
+/** is_radix_sortable.
+ * The radix sort is used for the arithmetic types that can be mapped onto an
+ * unsigned integer key of the same size (i.e. all of them but bool and
+ * long double).
+ */
+template <typename T>
+struct is_radix_sortable
+    : std::integral_constant<bool,
+                             (std::is_integral<T>::value &&
+                              !std::is_same<T, bool>::value) ||
+                                 (std::is_floating_point<T>::value &&
+                                  (sizeof(T) == 4 || sizeof(T) == 8))> {};
+
+/* radix_sort_items_per_work_item.
+ * Number of contiguous elements processed by each work-item of a radix sort
+ * pass.
+ */
+constexpr size_t radix_sort_items_per_work_item = 16;
+
+/*
+ * Compute the tiling used by every pass of radix_sort.
+ * The local memory must hold one counter per digit and work-item.
+ */
+inline sycl_algorithm_descriptor compute_radix_sort_descriptor(
+    cl::sycl::device device, size_t size) {
+  using std::max;
+  using std::min;
+  const auto properties = sycl::helpers::get_device_properties(device);
+  const auto max_work_item = properties.max_work_item;
+  size_t local_mem_size = properties.local_mem_size;
+
+  size_t nb_work_item = min(
+      max_work_item, local_mem_size / (radix_sort_radix * sizeof(unsigned int)));
+  nb_work_item = max(static_cast<size_t>(1), nb_work_item);
+
+  size_t size_per_work_group = nb_work_item * radix_sort_items_per_work_item;
+  size_t nb_work_group = up_rounded_division(size, size_per_work_group);
+
+  return sycl_algorithm_descriptor{size, size_per_work_group,
+                                   radix_sort_items_per_work_item,
+                                   nb_work_group, nb_work_item};
+}
+
+/* radix_sort_pass.
+ * Sorts the elements of in into out, according to the digit given by digit,
+ * preserving the order of the elements with the same digit.
+ */
+template <typename T, typename InBuffer, typename OutBuffer, class DigitOp>
+void radix_sort_pass(cl::sycl::queue q, InBuffer in, OutBuffer out,
+                     cl::sycl::buffer<size_t, 1> hist,
+                     const sycl_algorithm_descriptor &d, DigitOp digit) {
+  const size_t histSize = radix_sort_radix * d.nb_work_group;
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+      cl::sycl::range<1>{d.nb_work_item}};
+
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aI = in.template get_access<cl::sycl::access::mode::read>(h);
+    auto aH = hist.template get_access<cl::sycl::access::mode::write>(h);
+    cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        scratch(cl::sycl::range<1>{radix_sort_radix * d.nb_work_item}, h);
+    h.parallel_for(ndRange,
+                   radix_sort_count_kernel<T, DigitOp>(
+                       aI, aH, scratch, d.size, d.size_per_work_item, digit));
+  });
+
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aH = hist.template get_access<cl::sycl::access::mode::read_write>(h);
+    cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        scratch(cl::sycl::range<1>{d.nb_work_item}, h);
+    h.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{d.nb_work_item},
+                              cl::sycl::range<1>{d.nb_work_item}},
+        radix_sort_scan_kernel(aH, scratch, histSize));
+  });
+
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aI = in.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = out.template get_access<cl::sycl::access::mode::write>(h);
+    auto aH = hist.template get_access<cl::sycl::access::mode::read>(h);
+    cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+        scratch(cl::sycl::range<1>{radix_sort_radix * d.nb_work_item}, h);
+    h.parallel_for(ndRange, radix_sort_scatter_kernel<T, DigitOp>(
+                                aI, aO, aH, scratch, d.size,
+                                d.size_per_work_item, digit));
+  });
+}
+
+/* radix_sort.
+ * Performs a LSD radix sort on the given buffer.
+ * Every pass sorts radix_sort_bits bits of the keys, from the least to the
+ * most significant ones, ping-ponging between the buffer and a temporary one.
+ * The number of passes is always even so the result ends up in buf.
+ * The temporary buffers are added to temporaries, so the function returns
+ * without waiting for the kernels.
+ */
+template <typename T, typename Alloc>
+void radix_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                size_t vectorSize,
+                sycl::helpers::sycl_temporaries &temporaries) {
+  if (vectorSize < 2) {
+    return;
+  }
+  const int keyBits = sizeof(typename radix_sort_key<T>::bits_type) * 8;
+  const auto d = compute_radix_sort_descriptor(q.get_device(), vectorSize);
+
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  auto hist =
+      sycl::helpers::make_temp_buffer<size_t>(radix_sort_radix * d.nb_work_group);
+  temporaries.keep(tmp);
+  temporaries.keep(hist);
+
+  for (int shift = 0; shift < keyBits; shift += 2 * radix_sort_bits) {
+    radix_sort_pass<T>(q, buf, tmp, hist, d, radix_sort_digit_op<T>(shift));
+    radix_sort_pass<T>(q, tmp, buf, hist, d,
+                       radix_sort_digit_op<T>(shift + radix_sort_bits));
+  }
+}
+
+/* radix_sort.
+ * Performs a LSD radix sort on the given buffer, waiting for its temporary
+ * buffers to be released.
+ */
+template <typename T, typename Alloc>
+void radix_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                size_t vectorSize) {
+  sycl::helpers::sycl_temporaries temporaries;
+  radix_sort<T>(q, buf, vectorSize, temporaries);
+}
+
+/* radix_select.
+ * Returns the key (see radix_sort_key) of the element of rank k of the first
+ * vectorSize elements of buf, i.e. of the element that would be at position k
+ * if they were sorted.
+ * The digits of the key are found from the most significant one to the least
+ * significant one, each pass only counting the elements that share the
+ * digits found so far, so every pass does O(vectorSize) work. The state of
+ * the selection stays on the device until the key is read back.
+ */
+template <typename T, typename Buffer>
+typename radix_sort_key<T>::bits_type radix_select(
+    cl::sycl::queue q, Buffer buf, cl::sycl::buffer<size_t, 1> hist,
+    const sycl_algorithm_descriptor &d, size_t k) {
+  typedef typename radix_sort_key<T>::bits_type bits_type;
+  const int keyBits = sizeof(bits_type) * 8;
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+      cl::sycl::range<1>{d.nb_work_item}};
+
+  // the select kernel keeps one size_t counter per digit and work-item, so
+  // it may fit fewer work-items in local memory than the count kernel
+  const size_t local_mem_size =
+      sycl::helpers::get_device_properties(q.get_device()).local_mem_size;
+  const size_t nbSelectItem = std::max(
+      static_cast<size_t>(1),
+      std::min(d.nb_work_item,
+               local_mem_size / (radix_sort_radix * sizeof(size_t))));
+
+  cl::sycl::buffer<bits_type, 1> prefix{cl::sycl::range<1>{1}};
+  cl::sycl::buffer<size_t, 1> rank{cl::sycl::range<1>{1}};
+  {
+    auto hP = prefix.template get_access<cl::sycl::access::mode::write>();
+    auto hR = rank.template get_access<cl::sycl::access::mode::write>();
+    hP[0] = 0;
+    hR[0] = k;
+  }
+
+  for (int shift = keyBits - radix_sort_bits; shift >= 0;
+       shift -= radix_sort_bits) {
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aI = buf.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP = prefix.template get_access<cl::sycl::access::mode::read>(h);
+      auto aH = hist.template get_access<cl::sycl::access::mode::write>(h);
+      cl::sycl::accessor<unsigned int, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          scratch(cl::sycl::range<1>{radix_sort_radix * d.nb_work_item}, h);
+      h.parallel_for(ndRange, radix_select_count_kernel<T>(
+                                  aI, aP, aH, scratch, d.size,
+                                  d.size_per_work_item, shift));
+    });
+
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aH = hist.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP =
+          prefix.template get_access<cl::sycl::access::mode::read_write>(h);
+      auto aR = rank.template get_access<cl::sycl::access::mode::read_write>(h);
+      cl::sycl::accessor<size_t, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          scratch(cl::sycl::range<1>{radix_sort_radix * nbSelectItem}, h);
+      h.parallel_for(
+          cl::sycl::nd_range<1>{cl::sycl::range<1>{nbSelectItem},
+                                cl::sycl::range<1>{nbSelectItem}},
+          radix_select_kernel<T>(aH, aP, aR, scratch, d.nb_work_group, shift));
+    });
+  }
+
+  auto hP = prefix.template get_access<cl::sycl::access::mode::read>();
+  return hP[0];
+}
+
+/* radix_select_partition.
+ * Moves the first vectorSize elements of in to out, partitioned around the
+ * element of rank k: the lesser elements first, then the ones equal to it,
+ * then the greater ones, each group keeping its original order. The element
+ * of rank k thus ends up at position k of out.
+ */
+template <typename T, typename InBuffer, typename OutBuffer>
+void radix_select_partition(cl::sycl::queue q, InBuffer in, OutBuffer out,
+                            size_t vectorSize, size_t k) {
+  const auto d = compute_radix_sort_descriptor(q.get_device(), vectorSize);
+  auto hist =
+      sycl::helpers::make_temp_buffer<size_t>(radix_sort_radix * d.nb_work_group);
+
+  const auto pivot = radix_select<T>(q, in, hist, d, k);
+  radix_sort_pass<T>(q, in, out, hist, d,
+                     radix_select_partition_op<T>(pivot));
+}
+
+/* sort_copy.
+ * Copies the first count elements of in to out.
+ */
+template <typename T, typename InBuffer, typename OutBuffer>
+void sort_copy(cl::sycl::queue q, InBuffer in, OutBuffer out, size_t count) {
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aI = in.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = out.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for(cl::sycl::range<1>{count}, sort_copy_kernel<T>(aI, aO));
+  });
+}
+
+/* merge_sort_items_per_work_item.
+ * Number of contiguous output elements produced by each work-item of the
+ * merge sort kernels. Must be a power of two.
+ */
+constexpr size_t merge_sort_items_per_work_item = 8;
+
+/* merge_sort_uses_local_memory.
+ * Whether local memory can hold the two copies of the tile of at least one
+ * work-item. Larger elements are only merged in global memory.
+ */
+inline bool merge_sort_uses_local_memory(cl::sycl::device device,
+                                         size_t sizeofT) {
+  const auto properties = sycl::helpers::get_device_properties(device);
+  return properties.local_mem_size >=
+         2 * merge_sort_items_per_work_item * sizeofT;
+}
+
+/*
+ * Compute the tiling used by merge_sort.
+ * The tile of a work-group is sorted in local memory, which must hold two
+ * copies of it. The tile size is a power of two so that the merge passes
+ * always merge runs of full tiles.
+ * When local memory cannot hold a single tile, the work-groups are only
+ * bounded by the device, as the merge passes do not use local memory.
+ */
+inline sycl_algorithm_descriptor compute_merge_sort_descriptor(
+    cl::sycl::device device, size_t size, size_t sizeofT) {
+  using std::max;
+  using std::min;
+  const auto properties = sycl::helpers::get_device_properties(device);
+  const auto max_work_item = properties.max_work_item;
+  size_t local_mem_size = properties.local_mem_size;
+
+  size_t max_nb_work_item = min(
+      max_work_item, up_rounded_division(size, merge_sort_items_per_work_item));
+  if (merge_sort_uses_local_memory(device, sizeofT)) {
+    max_nb_work_item =
+        min(max_nb_work_item,
+            local_mem_size / (2 * merge_sort_items_per_work_item * sizeofT));
+  }
+  size_t nb_work_item = 1;
+  while (2 * nb_work_item <= max_nb_work_item) {
+    nb_work_item *= 2;
+  }
+
+  size_t size_per_work_group = nb_work_item * merge_sort_items_per_work_item;
+  size_t nb_work_group = up_rounded_division(size, size_per_work_group);
+
+  return sycl_algorithm_descriptor{size, size_per_work_group,
+                                   merge_sort_items_per_work_item,
+                                   nb_work_group, nb_work_item};
+}
+
+/* merge_sort_pass.
+ * Merges the pairs of sorted runs of the given width of in into out.
+ */
+template <typename T, class Less, typename Name, typename InBuffer,
+          typename OutBuffer>
+void merge_sort_pass(cl::sycl::queue q, InBuffer in, OutBuffer out,
+                     const sycl_algorithm_descriptor &d, size_t width,
+                     Less less) {
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aI = in.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = out.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<cl::sycl::helpers::NameGen<1, Name>>(
+        cl::sycl::nd_range<1>{
+            cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+            cl::sycl::range<1>{d.nb_work_item}},
+        merge_sort_merge_kernel<T, Less>(aI, aO, d.size, d.size_per_work_item,
+                                         width, less));
+  });
+}
+
+/* merge_sort.
+ * Performs a stable merge sort on the given buffer, for any size.
+ * Tiles are first sorted in local memory, then sorted runs are merged
+ * pairwise in global memory, ping-ponging with a temporary buffer, until a
+ * single run is left. Elements too large for a tile to fit in local memory
+ * skip the tile step and are merged in global memory from runs of width 1.
+ */
+template <typename T, typename Alloc, class Less, typename Name>
+void merge_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                size_t vectorSize, Less less) {
+  if (vectorSize < 2) {
+    return;
+  }
+  const auto d =
+      compute_merge_sort_descriptor(q.get_device(), vectorSize, sizeof(T));
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+      cl::sycl::range<1>{d.nb_work_item}};
+
+  size_t width = 1;
+  if (merge_sort_uses_local_memory(q.get_device(), sizeof(T))) {
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          scratch1(cl::sycl::range<1>{d.size_per_work_group}, h);
+      cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          scratch2(cl::sycl::range<1>{d.size_per_work_group}, h);
+      h.parallel_for<cl::sycl::helpers::NameGen<0, Name>>(
+          ndRange, merge_sort_tile_kernel<T, Less>(a, scratch1, scratch2,
+                                                   vectorSize,
+                                                   d.size_per_work_item,
+                                                   less));
+    });
+
+    if (d.size_per_work_group >= vectorSize) {
+      return;
+    }
+    width = d.size_per_work_group;
+  }
+
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  bool inBuf = true;
+  for (; width < vectorSize; width *= 2) {
+    if (inBuf) {
+      merge_sort_pass<T, Less, Name>(q, buf, tmp, d, width, less);
+    } else {
+      merge_sort_pass<T, Less, Name>(q, tmp, buf, d, width, less);
+    }
+    inBuf = !inBuf;
+  }
+
+  if (!inBuf) {
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aI = tmp.template get_access<cl::sycl::access::mode::read>(h);
+      auto aO = buf.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<cl::sycl::helpers::NameGen<2, Name>>(
+          cl::sycl::range<1>{vectorSize},
+          [aI, aO](cl::sycl::item<1> it) { aO[it] = aI[it]; });
+    });
+  }
+}
+
+/* merge_sort_by_key_pass.
+ * Merges the pairs of sorted runs of the given width of the keys and values
+ * in into out.
+ */
+template <typename K, typename V, class Less, typename Name,
+          typename InKeyBuffer, typename InValueBuffer, typename OutKeyBuffer,
+          typename OutValueBuffer>
+void merge_sort_by_key_pass(cl::sycl::queue q, InKeyBuffer inKeys,
+                            InValueBuffer inValues, OutKeyBuffer outKeys,
+                            OutValueBuffer outValues,
+                            const sycl_algorithm_descriptor &d, size_t width,
+                            Less less) {
+  q.submit([=](cl::sycl::handler &h) mutable {
+    auto aIK = inKeys.template get_access<cl::sycl::access::mode::read>(h);
+    auto aIV = inValues.template get_access<cl::sycl::access::mode::read>(h);
+    auto aOK = outKeys.template get_access<cl::sycl::access::mode::write>(h);
+    auto aOV = outValues.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<cl::sycl::helpers::NameGen<1, Name>>(
+        cl::sycl::nd_range<1>{
+            cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+            cl::sycl::range<1>{d.nb_work_item}},
+        merge_sort_by_key_merge_kernel<K, V, Less>(
+            aIK, aIV, aOK, aOV, d.size, d.size_per_work_item, width, less));
+  });
+}
+
+/* merge_sort_by_key.
+ * Performs a stable merge sort of the given buffer of keys, moving the
+ * elements of the buffer of values along with their keys.
+ * It follows the same steps as merge_sort, and the tiles of keys and values
+ * are both kept in local memory.
+ */
+template <typename K, typename V, class Less, typename Name,
+          typename KeyBuffer, typename ValueBuffer>
+void merge_sort_by_key(cl::sycl::queue q, KeyBuffer keys, ValueBuffer values,
+                       size_t vectorSize, Less less) {
+  if (vectorSize < 2) {
+    return;
+  }
+  const auto d = compute_merge_sort_descriptor(q.get_device(), vectorSize,
+                                               sizeof(K) + sizeof(V));
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{d.nb_work_group * d.nb_work_item},
+      cl::sycl::range<1>{d.nb_work_item}};
+
+  size_t width = 1;
+  if (merge_sort_uses_local_memory(q.get_device(), sizeof(K) + sizeof(V))) {
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aK = keys.template get_access<cl::sycl::access::mode::read_write>(h);
+      auto aV =
+          values.template get_access<cl::sycl::access::mode::read_write>(h);
+      cl::sycl::accessor<K, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          keys1(cl::sycl::range<1>{d.size_per_work_group}, h);
+      cl::sycl::accessor<K, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          keys2(cl::sycl::range<1>{d.size_per_work_group}, h);
+      cl::sycl::accessor<V, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          values1(cl::sycl::range<1>{d.size_per_work_group}, h);
+      cl::sycl::accessor<V, 1, cl::sycl::access::mode::read_write,
+                         cl::sycl::access::target::local>
+          values2(cl::sycl::range<1>{d.size_per_work_group}, h);
+      h.parallel_for<cl::sycl::helpers::NameGen<0, Name>>(
+          ndRange, merge_sort_by_key_tile_kernel<K, V, Less>(
+                       aK, aV, keys1, keys2, values1, values2, vectorSize,
+                       d.size_per_work_item, less));
+    });
+
+    if (d.size_per_work_group >= vectorSize) {
+      return;
+    }
+    width = d.size_per_work_group;
+  }
+
+  auto tmpKeys = sycl::helpers::make_temp_buffer<K>(vectorSize);
+  auto tmpValues = sycl::helpers::make_temp_buffer<V>(vectorSize);
+  bool inBuf = true;
+  for (; width < vectorSize; width *= 2) {
+    if (inBuf) {
+      merge_sort_by_key_pass<K, V, Less, Name>(q, keys, values, tmpKeys,
+                                               tmpValues, d, width, less);
+    } else {
+      merge_sort_by_key_pass<K, V, Less, Name>(q, tmpKeys, tmpValues, keys,
+                                               values, d, width, less);
+    }
+    inBuf = !inBuf;
+  }
+
+  if (!inBuf) {
+    q.submit([=](cl::sycl::handler &h) mutable {
+      auto aIK = tmpKeys.template get_access<cl::sycl::access::mode::read>(h);
+      auto aIV = tmpValues.template get_access<cl::sycl::access::mode::read>(h);
+      auto aOK = keys.template get_access<cl::sycl::access::mode::write>(h);
+      auto aOV = values.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<cl::sycl::helpers::NameGen<2, Name>>(
+          cl::sycl::range<1>{vectorSize},
+          [aIK, aIV, aOK, aOV](cl::sycl::item<1> it) {
+            aOK[it] = aIK[it];
+            aOV[it] = aIV[it];
+          });
+    });
+  }
+}
+
+template<typename T>
+struct buffer_traits;
+
+template<typename T, typename Alloc>
+struct buffer_traits<cl::sycl::buffer<T, 1, Alloc>> {
+  typedef Alloc allocator_type;
+};
+
+/* default_sort.
+ * Sorts arithmetic types with the radix sort.
+ */
+template <typename T, typename Alloc>
+void default_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t vectorSize, std::true_type) {
+  radix_sort<T>(q, buf, vectorSize);
+}
+
+/* default_sort.
+ * Sorts any other type with the bitonic sort.
+ */
+template <typename T, typename Alloc>
+void default_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t vectorSize, std::false_type) {
+  sycl::impl::bitonic_sort<T>(q, buf, vectorSize);
+}
+
+/* default_stable_sort.
+ * The radix sort used for arithmetic types is already stable.
+ */
+template <typename T, typename Alloc>
+void default_stable_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                         size_t vectorSize, std::true_type) {
+  radix_sort<T>(q, buf, vectorSize);
+}
+
+/* default_stable_sort.
+ * Sorts any other type with the merge sort.
+ */
+template <typename T, typename Alloc>
+void default_stable_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                         size_t vectorSize, std::false_type) {
+  sycl::impl::merge_sort<T, Alloc, std::less<T>, sort_kernel_merge<T>>(
+      q, buf, vectorSize, std::less<T>());
+}
+
+/* default_nth_element.
+ * Arithmetic types are partitioned around the element selected by the radix
+ * select.
+ */
+template <typename T, typename Alloc>
+void default_nth_element(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                         size_t vectorSize, size_t nth, std::true_type) {
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  radix_select_partition<T>(q, buf, tmp, vectorSize, nth);
+  sort_copy<T>(q, tmp, buf, vectorSize);
+}
+
+/* default_nth_element.
+ * Any other type is fully sorted by the merge sort, in O(n log n).
+ */
+template <typename T, typename Alloc>
+void default_nth_element(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                         size_t vectorSize, size_t /* nth */,
+                         std::false_type) {
+  default_stable_sort<T>(q, buf, vectorSize, std::false_type());
+}
+
+/* default_partial_sort.
+ * For arithmetic types, the middle first elements are selected by the radix
+ * select and only them are sorted.
+ */
+template <typename T, typename Alloc>
+void default_partial_sort(cl::sycl::queue q,
+                          cl::sycl::buffer<T, 1, Alloc> buf, size_t vectorSize,
+                          size_t middle, std::true_type) {
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  radix_select_partition<T>(q, buf, tmp, vectorSize, middle - 1);
+  radix_sort<T>(q, tmp, middle);
+  sort_copy<T>(q, tmp, buf, vectorSize);
+}
+
+/* default_partial_sort.
+ * Any other type is fully sorted by the merge sort, in O(n log n).
+ */
+template <typename T, typename Alloc>
+void default_partial_sort(cl::sycl::queue q,
+                          cl::sycl::buffer<T, 1, Alloc> buf, size_t vectorSize,
+                          size_t /* middle */, std::false_type) {
+  default_stable_sort<T>(q, buf, vectorSize, std::false_type());
+}
+
+/* default_partial_sort_copy.
+ * For arithmetic types, the elements to copy are selected by the radix
+ * select and only them are sorted.
+ */
+template <typename T, typename InBuffer, typename OutBuffer>
+void default_partial_sort_copy(cl::sycl::queue q, InBuffer in, OutBuffer out,
+                               size_t vectorSize, size_t outSize,
+                               std::true_type) {
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  radix_select_partition<T>(q, in, tmp, vectorSize, outSize - 1);
+  radix_sort<T>(q, tmp, outSize);
+  sort_copy<T>(q, tmp, out, outSize);
+}
+
+/* default_partial_sort_copy.
+ * Any other type is copied whole into a temporary buffer and fully sorted
+ * there by the merge sort, in O(n log n).
+ */
+template <typename T, typename InBuffer, typename OutBuffer>
+void default_partial_sort_copy(cl::sycl::queue q, InBuffer in, OutBuffer out,
+                               size_t vectorSize, size_t outSize,
+                               std::false_type) {
+  auto tmp = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  sort_copy<T>(q, in, tmp, vectorSize);
+  default_stable_sort<T>(q, tmp, vectorSize, std::false_type());
+  sort_copy<T>(q, tmp, out, outSize);
+}
+
+/** sort
+ * @brief Function that sorts the given range using the default comparison.
+ * The sort algorithm is chosen at compile time from the value type.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void sort(ExecutionPolicy &sep, RandomIt first, RandomIt last) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  default_sort<type_>(q, buf, vectorSize,
+                      std::integral_constant<bool,
+                                             is_radix_sortable<type_>::value>());
+}
+
+/** sort
+ * @brief Function that takes a Comp Operator and applies it to the given range
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param comp  : Comp Operator
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+void sort(ExecutionPolicy &sep, RandomIt first, RandomIt last, CompareOp comp) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
+
+  sycl::impl::bitonic_sort<
+      type_, allocator_, sort_comp_less<type_, CompareOp>,
+      bitonic_sort_name<typename ExecutionPolicy::kernelName>>(
+      q, buf, vectorSize, sort_comp_less<type_, CompareOp>(comp));
+}
+
+/* heterogeneous_sort_default.
+ * Sorts one part of a heterogeneous sort of arithmetic types with the radix
+ * sort, keeping its temporary buffers in temporaries.
+ */
+template <typename T, typename Alloc>
+void heterogeneous_sort_default(cl::sycl::queue q,
+                                cl::sycl::buffer<T, 1, Alloc> buf,
+                                size_t vectorSize,
+                                sycl::helpers::sycl_temporaries &temporaries,
+                                std::true_type) {
+  radix_sort<T>(q, buf, vectorSize, temporaries);
+}
+
+/* heterogeneous_sort_default.
+ * Sorts one part of a heterogeneous sort of any other type with the bitonic
+ * sort, which needs no temporary buffer.
+ */
+template <typename T, typename Alloc>
+void heterogeneous_sort_default(cl::sycl::queue q,
+                                cl::sycl::buffer<T, 1, Alloc> buf,
+                                size_t vectorSize,
+                                sycl::helpers::sycl_temporaries &,
+                                std::false_type) {
+  sycl::impl::bitonic_sort<T>(q, buf, vectorSize);
+}
+
+/* heterogeneous_sort_part.
+ * Sorts one part of a heterogeneous sort with the default comparison.
+ */
+template <typename Name, typename T, typename Alloc>
+void heterogeneous_sort_part(cl::sycl::queue q,
+                             cl::sycl::buffer<T, 1, Alloc> buf,
+                             size_t vectorSize,
+                             sycl::helpers::sycl_temporaries &temporaries,
+                             sort_default_less<T>) {
+  heterogeneous_sort_default<T>(
+      q, buf, vectorSize, temporaries,
+      std::integral_constant<bool, is_radix_sortable<T>::value>());
+}
+
+/* heterogeneous_sort_part.
+ * Sorts one part of a heterogeneous sort with a Comp Operator.
+ */
+template <typename Name, typename T, typename Alloc, class Less>
+void heterogeneous_sort_part(cl::sycl::queue q,
+                             cl::sycl::buffer<T, 1, Alloc> buf,
+                             size_t vectorSize,
+                             sycl::helpers::sycl_temporaries &, Less less) {
+  sycl::impl::bitonic_sort<T, Alloc, Less, bitonic_sort_name<Name>>(
+      q, buf, vectorSize, less);
+}
+
+/** heterogeneous_sort
+ * @brief Function that sorts the given range on two devices.
+ * The first crosspoint elements are sorted on q1 and the others on q2, both
+ * parts being sorted at the same time; the two sorted runs are then merged
+ * on the host, so that no device holds more than its part of the range.
+ * @param q1         : Queue sorting the first part and merging
+ * @param q2         : Queue sorting the second part
+ * @param first      : Start of the range
+ * @param last       : End of the range
+ * @param crosspoint : Number of elements sorted on q1
+ * @param less       : Ordering of the elements
+ */
+template <typename Name, class RandomIt, class Less>
+void heterogeneous_sort(cl::sycl::queue q1, cl::sycl::queue q2,
+                        RandomIt first, RandomIt last, size_t crosspoint,
+                        Less less) {
+  static_assert(
+      !std::is_base_of<sycl::helpers::SyclIterator, RandomIt>::value,
+      "heterogeneous_sort splits a host range between two devices, the "
+      "iterators of a SYCL buffer cannot be split");
+  const size_t vectorSize = std::distance(first, last);
+
+  if (crosspoint < 1 || crosspoint >= vectorSize) {
+    cl::sycl::queue q = (crosspoint < 1) ? q2 : q1;
+    sycl::helpers::sycl_temporaries temporaries;
+    auto buf = sycl::helpers::make_buffer(first, last);
+    heterogeneous_sort_part<Name>(q, buf, vectorSize, temporaries, less);
+    return;
+  }
+
+  {
+    // the temporary buffers of both parts live until both queues are done,
+    // so the second part is submitted while the first one is sorted
+    sycl::helpers::sycl_temporaries temporaries;
+    auto buf1 = sycl::helpers::make_buffer(first, first + crosspoint);
+    auto buf2 = sycl::helpers::make_buffer(first + crosspoint, last);
+    heterogeneous_sort_part<Name>(q1, buf1, crosspoint, temporaries, less);
+    heterogeneous_sort_part<Name>(q2, buf2, vectorSize - crosspoint,
+                                  temporaries, less);
+    // wait for queues
+    q1.wait_and_throw();
+    q2.wait_and_throw();
+  }
+
+  std::inplace_merge(first, first + crosspoint, last, less);
+}
+
+/** stable_sort
+ * @brief Function that sorts the given range with operator<, preserving the
+ * order of equivalent elements
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void stable_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  default_stable_sort<type_>(
+      q, buf, vectorSize,
+      std::integral_constant<bool, is_radix_sortable<type_>::value>());
+}
+
+/** stable_sort
+ * @brief Function that sorts the given range with a Comp Operator,
+ * preserving the order of equivalent elements
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true if its first argument is ordered
+ *                before the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+void stable_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last,
+                 CompareOp comp) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
+
+  sycl::impl::merge_sort<type_, allocator_, CompareOp,
+                         merge_sort_name<typename ExecutionPolicy::kernelName>>(
+      q, buf, vectorSize, comp);
+}
+
+/** segmented_sort
+ * @brief Function that sorts independently every segment of segment_size
+ * consecutive elements of the given range (the last one may be shorter).
+ * All the segments are sorted by the same kernels.
+ * @param sep          : Execution Policy
+ * @param first        : Start of the range
+ * @param last         : End of the range
+ * @param segment_size : Number of elements of each segment
+ * @param comp         : Comp Operator, returns true if its first argument is
+ *                       ordered before the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+void segmented_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last,
+                    size_t segment_size, CompareOp comp) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
+
+  sycl::impl::bitonic_sort_rows<
+      type_, allocator_, CompareOp,
+      segmented_sort_name<typename ExecutionPolicy::kernelName>>(
+      q, buf, vectorSize, segment_size, comp);
+}
+
+/** partial_sort
+ * @brief Function that rearranges the given range so that [first, middle)
+ * holds its middle - first smallest elements (according to operator<) in
+ * sorted order. The order of the other elements is unspecified.
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param middle : End of the range to sort
+ * @param last   : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void partial_sort(ExecutionPolicy &sep, RandomIt first, RandomIt middle,
+                  RandomIt last) {
+  if (first == middle) {
+    return;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  default_partial_sort<type_>(
+      q, buf, vectorSize, std::distance(first, middle),
+      std::integral_constant<bool, is_radix_sortable<type_>::value>());
+}
+
+/** partial_sort
+ * @brief Function that rearranges the given range so that [first, middle)
+ * holds its middle - first smallest elements (according to a Comp Operator)
+ * in sorted order. The order of the other elements is unspecified.
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param middle : End of the range to sort
+ * @param last   : End of the range
+ * @param comp   : Comp Operator, returns true if its first argument is
+ *                 ordered before the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+void partial_sort(ExecutionPolicy &sep, RandomIt first, RandomIt middle,
+                  RandomIt last, CompareOp comp) {
+  if (first == middle) {
+    return;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
+
+  sycl::impl::merge_sort<
+      type_, allocator_, CompareOp,
+      partial_sort_name<typename ExecutionPolicy::kernelName>>(
+      q, buf, vectorSize, comp);
+}
+
+/** partial_sort_copy
+ * @brief Function that copies the smallest elements (according to operator<)
+ * of the input range, in sorted order, to the output range, until either of
+ * them is exhausted. Only the copied elements are written back.
+ * @param sep     : Execution Policy
+ * @param first   : Start of the input range
+ * @param last    : End of the input range
+ * @param d_first : Start of the output range
+ * @param d_last  : End of the output range
+ * @return An iterator past the last copied element
+ */
+template <class ExecutionPolicy, class InputIt, class RandomIt>
+RandomIt partial_sort_copy(ExecutionPolicy &sep, InputIt first, InputIt last,
+                           RandomIt d_first, RandomIt d_last) {
+  typedef typename std::iterator_traits<InputIt>::value_type type_;
+  const size_t outSize =
+      std::min(static_cast<size_t>(std::distance(first, last)),
+               static_cast<size_t>(std::distance(d_first, d_last)));
+  if (outSize == 0) {
+    return d_first;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  auto in = sycl::helpers::make_const_buffer(first, last);
+  auto vectorSize = in.get_count();
+  {
+    auto out = sycl::helpers::make_buffer(d_first, d_first + outSize);
+    default_partial_sort_copy<type_>(
+        q, in, out, vectorSize, outSize,
+        std::integral_constant<bool, is_radix_sortable<type_>::value>());
+  }
+  return d_first + outSize;
+}
+
+/** partial_sort_copy
+ * @brief Function that copies the smallest elements (according to a Comp
+ * Operator) of the input range, in sorted order, to the output range, until
+ * either of them is exhausted. Only the copied elements are written back.
+ * @param sep     : Execution Policy
+ * @param first   : Start of the input range
+ * @param last    : End of the input range
+ * @param d_first : Start of the output range
+ * @param d_last  : End of the output range
+ * @param comp    : Comp Operator, returns true if its first argument is
+ *                  ordered before the second one
+ * @return An iterator past the last copied element
+ */
+template <class ExecutionPolicy, class InputIt, class RandomIt,
+          class CompareOp>
+RandomIt partial_sort_copy(ExecutionPolicy &sep, InputIt first, InputIt last,
+                           RandomIt d_first, RandomIt d_last, CompareOp comp) {
+  typedef typename std::iterator_traits<InputIt>::value_type type_;
+  const size_t outSize =
+      std::min(static_cast<size_t>(std::distance(first, last)),
+               static_cast<size_t>(std::distance(d_first, d_last)));
+  if (outSize == 0) {
+    return d_first;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  auto in = sycl::helpers::make_const_buffer(first, last);
+  auto vectorSize = in.get_count();
+  auto tmp = sycl::helpers::make_temp_buffer<type_>(vectorSize);
+  typedef typename buffer_traits<decltype(tmp)>::allocator_type allocator_;
+  sort_copy<type_>(q, in, tmp, vectorSize);
+  sycl::impl::merge_sort<
+      type_, allocator_, CompareOp,
+      partial_sort_name<typename ExecutionPolicy::kernelName>>(
+      q, tmp, vectorSize, comp);
+  {
+    auto out = sycl::helpers::make_buffer(d_first, d_first + outSize);
+    sort_copy<type_>(q, tmp, out, outSize);
+  }
+  return d_first + outSize;
+}
+
+/** nth_element
+ * @brief Function that rearranges the given range so that the element at nth
+ * is the one that would be there if the range was sorted (according to
+ * operator<), with no greater element before it and no lesser element after
+ * it.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param nth   : Position of the element to select
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void nth_element(ExecutionPolicy &sep, RandomIt first, RandomIt nth,
+                 RandomIt last) {
+  if (nth == last) {
+    return;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  default_nth_element<type_>(
+      q, buf, vectorSize, std::distance(first, nth),
+      std::integral_constant<bool, is_radix_sortable<type_>::value>());
+}
+
+/** nth_element
+ * @brief Function that rearranges the given range so that the element at nth
+ * is the one that would be there if the range was sorted (according to a
+ * Comp Operator), with no greater element before it and no lesser element
+ * after it.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param nth   : Position of the element to select
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true if its first argument is ordered
+ *                before the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+void nth_element(ExecutionPolicy &sep, RandomIt first, RandomIt nth,
+                 RandomIt last, CompareOp comp) {
+  if (nth == last) {
+    return;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
+
+  sycl::impl::merge_sort<
+      type_, allocator_, CompareOp,
+      nth_element_name<typename ExecutionPolicy::kernelName>>(
+      q, buf, vectorSize, comp);
+}
+
+/** sort_by_key
+ * @brief Function that sorts the range of keys, moving the elements of the
+ * range of values along with their keys. The sort is stable.
+ * @param sep          : Execution Policy
+ * @param keys_first   : Start of the range of keys
+ * @param keys_last    : End of the range of keys
+ * @param values_first : Start of the range of values
+ * @param comp         : Comp Operator, returns true if its first argument is
+ *                       ordered before the second one
+ */
+template <class ExecutionPolicy, class KeyIt, class ValueIt, class CompareOp>
+void sort_by_key(ExecutionPolicy &sep, KeyIt keys_first, KeyIt keys_last,
+                 ValueIt values_first, CompareOp comp) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<KeyIt>::value_type key_type_;
+  typedef typename std::iterator_traits<ValueIt>::value_type value_type_;
+  auto keys = sycl::helpers::make_buffer(keys_first, keys_last);
+  auto vectorSize = keys.get_count();
+  auto values =
+      sycl::helpers::make_buffer(values_first, values_first + vectorSize);
+
+  sycl::impl::merge_sort_by_key<
+      key_type_, value_type_, CompareOp,
+      sort_by_key_name<typename ExecutionPolicy::kernelName>>(
+      q, keys, values, vectorSize, comp);
 }
 
 }  // namespace impl
@@ -0,0 +1,86 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
+#define __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/mapscan.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* transform_inclusive_scan.
+ * Scan of the elements of [b, e) transformed by uop, including init and
+ * every element. The transformation is done in the kernels of the scan, no
+ * intermediate buffer holds the transformed elements.
+ */
+template <typename ExecutionPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryOperation,
+          typename UnaryOperation>
+OutputIterator transform_inclusive_scan(ExecutionPolicy &snp, InputIterator b,
+                                        InputIterator e, OutputIterator o,
+                                        T init, BinaryOperation bop,
+                                        UnaryOperation uop) {
+  return mapscan(snp, b, e, o, init, uop, bop, false);
+}
+
+/* transform_inclusive_scan.
+ * Scan of the elements of [b, e) transformed by uop, without initial value:
+ * the first transformed element seeds the scan of the others, so bop needs
+ * no identity.
+ */
+template <typename ExecutionPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryOperation,
+          typename UnaryOperation>
+OutputIterator transform_inclusive_scan(ExecutionPolicy &snp, InputIterator b,
+                                        InputIterator e, OutputIterator o,
+                                        BinaryOperation bop,
+                                        UnaryOperation uop) {
+  using B = mapscan_result<InputIterator, UnaryOperation>;
+  if (sycl::helpers::distance(b, e) <= 0)
+    return o;
+
+  B first = B(uop(mapscan_get(b)));
+  auto end = mapscan(snp, std::next(b), e, std::next(o), first, uop, bop,
+                     false);
+  // written once the scan has read the input, which o may overlap
+  mapscan_set(o, first);
+  return end;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
@@ -36,33 +36,88 @@
 // SYCL helpers header
 #include <sycl/helpers/sycl_buffers.hpp>
 #include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_future.hpp>
 #include <sycl/algorithm/algorithm_composite_patterns.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
 
 namespace sycl {
 namespace impl {
 
+/* transform_reduce_async.
+ * Compensated transform_reduce, selected by a compensated_plus binary
+ * operation. The kernels are submitted, the returned handle gives access to
+ * the result.
+ */
+template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
+          typename U, typename T>
+sycl::helpers::sycl_future<T> transform_reduce_async(
+    ExecutionPolicy& snp, InputIt b, InputIt e, UnaryOperation unary_op,
+    U init,
+    sycl::helpers::compensated_plus<T> binary_op) {
+
+  auto size = sycl::helpers::distance(b, e);
+  if (size <= 0)
+    return sycl::helpers::sycl_future<T>(T(init));
+
+  auto q = snp.get_queue();
+
+  auto device = q.get_device();
+
+  using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+  auto d = compute_mapreduce_descriptor(
+      device, size, sizeof(sycl::helpers::compensated_value<T>));
+
+  auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  cl::sycl::buffer<T, 1> output_buff { cl::sycl::range<1> { 1 } };
+
+  auto map = [=](size_t pos, value_type x) { return T(unary_op(x)); };
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_compensated_mapreduce(snp, q, input_buff, output_buff,
+                                            T(init), d, map, temporaries);
+  return sycl::helpers::sycl_future<T>(output_buff, event,
+                                       temporaries.share());
+}
+
 /* transform_reduce.
-* @brief Returns the transform_reduce of one vector across the range [first1,
-* last1) by applying Functions op1 and op2. Implementation of the command
-* group
-* that submits a transform_reduce kernel.
+ * Compensated transform_reduce, selected by a compensated_plus binary
+ * operation.
+ */
+template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
+          typename U, typename T>
+T transform_reduce(ExecutionPolicy& snp, InputIt b, InputIt e,
+                   UnaryOperation unary_op,
+                   U init,
+                   sycl::helpers::compensated_plus<T> binary_op) {
+  return sycl::impl::transform_reduce_async(snp, b, e, unary_op, init,
+                                            binary_op).get();
+}
+
+/* transform_reduce_async.
+* @brief Starts the transform_reduce of one vector across the range [first1,
+* last1) by applying Functions op1 and op2, and returns a handle on its
+* result. Implementation of the command group that submits a
+* transform_reduce kernel.
 */
 
 #ifdef SYCL_PSTL_USE_OLD_ALGO
 
 template <class ExecutionPolicy, class InputIterator, class UnaryOperation,
           class T, class BinaryOperation>
-T transform_reduce(ExecutionPolicy& exec, InputIterator first,
-                   InputIterator last, UnaryOperation unary_op, T init,
-                   BinaryOperation binary_op) {
+sycl::helpers::sycl_future<T> transform_reduce_async(
+    ExecutionPolicy& exec, InputIterator first, InputIterator last,
+    UnaryOperation unary_op, T init, BinaryOperation binary_op) {
   cl::sycl::queue q(exec.get_queue());
   auto vectorSize = sycl::helpers::distance(first, last);
   
   if (vectorSize < 1) {
-    return init;
+    return sycl::helpers::sycl_future<T>(init);
   }
 
   cl::sycl::buffer<T, 1> bufR((cl::sycl::range<1>(vectorSize)));
+  cl::sycl::buffer<T, 1> bufT { cl::sycl::range<1> { 1 } };
 
   auto device = q.get_device();
   auto bufI = sycl::helpers::make_const_buffer(first, last);
@@ -99,22 +154,44 @@ T transform_reduce(ExecutionPolicy& exec, InputIterator first,
     ndRange = cl::sycl::nd_range<1>{cl::sycl::range<1>(std::max(length, local)),
                                     ndRange.get_local_range()};
   } while (length > 1);
-  q.wait_and_throw();
-  auto hR = bufR.template get_access<cl::sycl::access::mode::read>();
-  return binary_op(hR[0], init);
+
+  auto event = q.submit([&](cl::sycl::handler& h) {
+    auto aR = bufR.template get_access<cl::sycl::access::mode::read>(h);
+    auto aT = bufT.template get_access<cl::sycl::access::mode::write>(h);
+    h.single_task<cl::sycl::helpers::NameGen<
+        11, typename ExecutionPolicy::kernelName>>(
+        [aR, aT, init, binary_op]() { aT[0] = binary_op(aR[0], init); });
+  });
+
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(bufI);
+  temporaries.keep(bufR);
+  return sycl::helpers::sycl_future<T>(bufT, event, temporaries.share());
+}
+
+/* transform_reduce.
+ * Waits for the result of transform_reduce_async.
+ */
+template <class ExecutionPolicy, class InputIterator, class UnaryOperation,
+          class T, class BinaryOperation>
+T transform_reduce(ExecutionPolicy& exec, InputIterator first,
+                   InputIterator last, UnaryOperation unary_op, T init,
+                   BinaryOperation binary_op) {
+  return sycl::impl::transform_reduce_async(exec, first, last, unary_op, init,
+                                            binary_op).get();
 }
 
 #else
 
 template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
           typename T, typename BinaryOperation>
-T transform_reduce(ExecutionPolicy& snp, InputIt b,
-                   InputIt e, UnaryOperation unary_op, T init,
-                   BinaryOperation binary_op) {
+sycl::helpers::sycl_future<T> transform_reduce_async(
+    ExecutionPolicy& snp, InputIt b, InputIt e, UnaryOperation unary_op,
+    T init, BinaryOperation binary_op) {
 
   auto size = sycl::helpers::distance(b, e);
   if (size <= 0)
-    return init;
+    return sycl::helpers::sycl_future<T>(init);
 
   auto q = snp.get_queue();
 
@@ -125,12 +202,26 @@ T transform_reduce(ExecutionPolicy& snp, InputIt b,
   auto d = compute_mapreduce_descriptor(device, size, sizeof(value_type));
 
   auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  cl::sycl::buffer<T, 1> output_buff { cl::sycl::range<1> { 1 } };
 
   auto map = [=](size_t pos, value_type x) { return unary_op(x); };
 
 
-  return buffer_mapreduce( snp, q, input_buff, init, d, map, binary_op );
+  sycl::helpers::sycl_temporaries temporaries;
+  temporaries.keep(input_buff);
+  auto event = buffer_mapreduce( snp, q, input_buff, output_buff, init, d,
+                                 map, binary_op, temporaries );
+  return sycl::helpers::sycl_future<T>(output_buff, event,
+                                       temporaries.share());
+}
 
+template <typename ExecutionPolicy, typename InputIt, typename UnaryOperation,
+          typename T, typename BinaryOperation>
+T transform_reduce(ExecutionPolicy& snp, InputIt b,
+                   InputIt e, UnaryOperation unary_op, T init,
+                   BinaryOperation binary_op) {
+  return sycl::impl::transform_reduce_async(snp, b, e, unary_op, init,
+                                            binary_op).get();
 }
 
 #endif
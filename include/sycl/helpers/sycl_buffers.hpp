@@ -44,6 +44,8 @@
 #include <type_traits>
 #include <typeinfo>
 #include <memory>
+#include <iterator>
+#include <vector>
 
 /** @defgroup sycl_helpers
  *
@@ -60,6 +62,26 @@
 namespace sycl {
 namespace helpers {
 
+/**
+ * @brief Tells whether Iterator points to elements stored contiguously in
+ *   host memory, so that a buffer can use them directly: pointers and
+ *   std::vector iterators (but std::vector<bool>).
+ */
+template <typename Iterator>
+struct is_contiguous_iterator {
+ private:
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+  using vector_type = std::vector<typename std::conditional<
+      std::is_object<value_type>::value, value_type, char>::type>;
+
+ public:
+  static constexpr bool value =
+      std::is_pointer<Iterator>::value ||
+      (!std::is_same<value_type, bool>::value &&
+       (std::is_same<Iterator, typename vector_type::iterator>::value ||
+        std::is_same<Iterator, typename vector_type::const_iterator>::value));
+};
+
 /**
  *
  * @brief Creates a buffer from a random access iterator that triggers
@@ -0,0 +1,83 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Compensated summation of floating point values
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_COMPENSATED__
+#define __EXPERIMENTAL_DETAIL_SYCL_COMPENSATED__
+
+namespace sycl {
+namespace helpers {
+
+/**
+ * @brief Addition of values of type T. Passed as the binary operation of
+ * reduce or transform_reduce, it selects a compensated summation, which
+ * keeps the rounding errors of the additions aside and adds them back at
+ * the end.
+ */
+template <typename T>
+struct compensated_plus {
+  typedef T value_type;
+
+  T operator()(const T &a, const T &b) const { return a + b; }
+};
+
+/**
+ * @brief A sum along with the rounding error of the additions that
+ * produced it
+ */
+template <typename T>
+struct compensated_value {
+  T sum;
+  T error;
+};
+
+/**
+ * @brief Kahan-Babuska addition of two compensated values. The rounding
+ * error of a.sum + b.sum is computed exactly and added to the errors of a
+ * and b, then as much of the total error as possible is moved back into the
+ * sum, so that the error stays small however many values are added
+ */
+template <typename T>
+compensated_value<T> compensated_add(const compensated_value<T> &a,
+                                     const compensated_value<T> &b) {
+  const T sum = a.sum + b.sum;
+  const T b_part = sum - a.sum;
+  const T error =
+      ((a.sum - (sum - b_part)) + (b.sum - b_part)) + (a.error + b.error);
+  const T new_sum = sum + error;
+  return compensated_value<T>{new_sum, error - (new_sum - sum)};
+}
+
+} /** @} namespace helpers */
+} /** @} namespace sycl */
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_COMPENSATED__
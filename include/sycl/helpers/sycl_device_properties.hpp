@@ -0,0 +1,95 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Cache of the device properties used to size the kernels
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_DEVICE_PROPERTIES__
+#define __EXPERIMENTAL_DETAIL_SYCL_DEVICE_PROPERTIES__
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycl {
+namespace helpers {
+
+/**
+ * @brief Properties of a device used to compute the number of work-groups
+ * and work-items of the kernels
+ */
+struct device_properties {
+  /** Number of compute units */
+  size_t max_compute_units;
+  /** Maximum number of work-items of a one dimensional work-group */
+  size_t max_work_item;
+  /** Size of the local memory of a work-group, in bytes */
+  size_t local_mem_size;
+};
+
+/**
+ * @brief Returns the properties of the device. They are queried once per
+ * device, then read from a cache shared by all the algorithms, since every
+ * query is a call to the driver
+ * @param device Device to query
+ */
+inline device_properties get_device_properties(
+    const cl::sycl::device &device) {
+  static std::mutex cache_mutex;
+  static std::vector<std::pair<cl::sycl::device, device_properties>> cache;
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  for (const auto &entry : cache) {
+    if (entry.first == device) {
+      return entry.second;
+    }
+  }
+
+  const cl::sycl::id<3> max_work_item_sizes =
+      device.get_info<cl::sycl::info::device::max_work_item_sizes>();
+  device_properties properties;
+  properties.max_compute_units =
+      device.get_info<cl::sycl::info::device::max_compute_units>();
+  properties.max_work_item = std::min<size_t>(
+      device.get_info<cl::sycl::info::device::max_work_group_size>(),
+      max_work_item_sizes[0]);
+  properties.local_mem_size =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+  cache.emplace_back(device, properties);
+  return properties;
+}
+
+} /** @} namespace helpers */
+} /** @} namespace sycl */
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_DEVICE_PROPERTIES__
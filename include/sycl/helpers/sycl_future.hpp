@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+
+/**
+ * @file
+ * @brief Handle on the result of an asynchronous algorithm
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
+#define __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace sycl {
+namespace helpers {
+
+/**
+ *
+ * @brief Buffers used by the kernels of an asynchronous algorithm.
+ * Destroying a buffer waits for the kernels using it, so the algorithm keeps
+ * its input and temporary buffers here and hands them over to the handle it
+ * returns, which destroys them once it is itself destroyed.
+ *
+ */
+class sycl_temporaries {
+  std::vector<std::shared_ptr<void>> buffers_;
+
+ public:
+  /**
+   * @brief Keeps a copy of buffer alive
+   */
+  template <typename Buffer>
+  void keep(Buffer buffer) {
+    buffers_.push_back(std::make_shared<Buffer>(buffer));
+  }
+
+  /**
+   * @brief Moves the buffers kept so far to a shared state, for a handle
+   */
+  std::shared_ptr<void> share() {
+    return std::make_shared<sycl_temporaries>(std::move(*this));
+  }
+};
+
+/**
+ *
+ * @brief Handle on the kernels of an asynchronous algorithm writing to a
+ * buffer owned by the caller. The handle keeps alive the buffers used by the
+ * kernels, so that returning from the algorithm does not wait for them.
+ * Destroying the last copy of the handle waits for the kernels.
+ *
+ */
+class sycl_event_handle {
+  cl::sycl::event event_;
+  std::shared_ptr<void> buffers_;
+
+ public:
+  /**
+   * @brief Handle on the kernels ending with the one tracked by event
+   * @param event   Event of the last kernel of the algorithm
+   * @param buffers Buffers used by the kernels
+   */
+  sycl_event_handle(cl::sycl::event event,
+                    std::shared_ptr<void> buffers = nullptr)
+      : event_(event), buffers_(buffers) {}
+
+  /**
+   * @brief Waits for the kernels to complete
+   */
+  void wait() { event_.wait_and_throw(); }
+
+  /**
+   * @brief Returns the event of the last kernel of the algorithm
+   */
+  cl::sycl::event get_event() const { return event_; }
+};
+
+/**
+ *
+ * @brief Handle on a single value computed on the device by an asynchronous
+ * algorithm, in the spirit of std::future. The value stays in a one element
+ * buffer until get() is called, which is the only call that reads it back
+ * to the host. Copies of the handle share the same result.
+ * The handle also keeps alive the buffers used by the computation, so that
+ * returning from the algorithm does not wait for the kernels to complete.
+ *
+ */
+template <typename T>
+class sycl_future {
+  cl::sycl::buffer<T, 1> result_;
+  cl::sycl::event event_;
+  std::shared_ptr<void> inputs_;
+
+ public:
+  /**
+   * @brief Handle on the value that the kernel tracked by event writes to
+   * result[0]
+   * @param result One element buffer holding the value
+   * @param event  Event of the last kernel writing the value
+   * @param inputs Buffers used by the computation
+   */
+  sycl_future(cl::sycl::buffer<T, 1> result, cl::sycl::event event,
+              std::shared_ptr<void> inputs = nullptr)
+      : result_(result), event_(event), inputs_(inputs) {}
+
+  /**
+   * @brief Handle on a value that is already known on the host
+   */
+  explicit sycl_future(T value) : result_(cl::sycl::range<1>(1)) {
+    auto write_result =
+        result_.template get_access<cl::sycl::access::mode::write>();
+    write_result[0] = value;
+  }
+
+  /**
+   * @brief Waits for the value to be computed
+   */
+  void wait() { event_.wait_and_throw(); }
+
+  /**
+   * @brief Waits for the value to be computed and returns it
+   */
+  T get() {
+    auto read_result =
+        result_.template get_access<cl::sycl::access::mode::read>();
+    return read_result[0];
+  }
+
+  /**
+   * @brief Returns the buffer holding the value, for further computations
+   * on the device
+   */
+  cl::sycl::buffer<T, 1> get_buffer() const { return result_; }
+
+  /**
+   * @brief Returns the event of the last kernel writing the value
+   */
+  cl::sycl::event get_event() const { return event_; }
+};
+
+} /** @} namespace helpers */
+} /** @} namespace sycl */
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
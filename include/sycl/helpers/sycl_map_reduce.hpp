@@ -0,0 +1,66 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Description of one of the reductions computed by multi_reduce
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_MAP_REDUCE__
+#define __EXPERIMENTAL_DETAIL_SYCL_MAP_REDUCE__
+
+namespace sycl {
+namespace helpers {
+
+/**
+ * @brief One of the reductions computed by multi_reduce: every element is
+ * transformed with map, and the results are combined with reduce, starting
+ * from init.
+ */
+template <typename T, typename Map, typename Reduce>
+struct map_reduce {
+  T init;
+  Map map;
+  Reduce reduce;
+};
+
+/**
+ * @brief Builds a map_reduce, deducing its types from the arguments
+ * @param init   Initial value, map is not applied on it
+ * @param map    Unary operation applied on every element
+ * @param reduce Binary operation combining the transformed elements
+ */
+template <typename T, typename Map, typename Reduce>
+map_reduce<T, Map, Reduce> make_map_reduce(T init, Map map, Reduce reduce) {
+  return map_reduce<T, Map, Reduce>{init, map, reduce};
+}
+
+} /** @} namespace helpers */
+} /** @} namespace sycl */
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_MAP_REDUCE__
@@ -33,6 +33,7 @@
 #include <CL/sycl.hpp>
 #include <sycl/execution_policy>
 #include <sycl/algorithm/transform.hpp>
+#include <sycl/algorithm/sort.hpp>
 
 namespace sycl {
 
@@ -110,6 +111,41 @@ class sycl_heterogeneous_execution_policy
     }
     return last1;
   }
+
+  /** sort
+   * @brief Function that sorts the given range. Each part of the range is
+   * sorted on its own device, then the two sorted runs are merged on the
+   * host. The range must be on the host.
+   * @param first : Start of the range
+   * @param last  : End of the range
+   */
+  template <class RandomIt>
+  void sort(RandomIt first, RandomIt last) {
+    typedef typename std::iterator_traits<RandomIt>::value_type type_;
+    size_t crosspoint = std::distance(first, last) * ratio;
+    impl::heterogeneous_sort<KernelName>(this->get_queue(), q2, first, last,
+                                         crosspoint,
+                                         sort_default_less<type_>());
+  }
+
+  /** sort
+   * @brief Function that takes a Comp Operator and applies it to the given
+   * range. Each part of the range is sorted on its own device, then the two
+   * sorted runs are merged on the host. The range must be on the host.
+   * @param first : Start of the range
+   * @param last  : End of the range
+   * @param comp  : Comp Operator
+   */
+  template <class RandomIt, class Compare>
+  void sort(RandomIt first, RandomIt last, Compare comp) {
+    auto named_sep = getNamedPolicy(*this, comp);
+    typedef typename std::iterator_traits<RandomIt>::value_type type_;
+    typedef typename decltype(named_sep)::kernelName kernelName_;
+    size_t crosspoint = std::distance(first, last) * ratio;
+    impl::heterogeneous_sort<kernelName_>(
+        this->get_queue(), q2, first, last, crosspoint,
+        sort_comp_less<type_, Compare>(comp));
+  }
 };
 
 }  // sycl
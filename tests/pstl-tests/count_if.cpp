@@ -58,3 +58,31 @@ TEST_F(CountIfAlgorithm, TestSyclCountIf) {
 
   EXPECT_TRUE(res_std == res_sycl);
 }
+
+TEST_F(CountIfAlgorithm, TestSyclCountIfAsync) {
+  std::vector<int> v(1024);
+  std::iota(v.begin(), v.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class CountIfAsyncAlgorithm> snp(q);
+  auto res_sycl =
+      count_if_async(snp, v.begin(), v.end(), [=](int x) { return x % 3 == 0; });
+
+  EXPECT_EQ(342, res_sycl.get());
+}
+
+TEST_F(CountIfAlgorithm, TestSyclCountIfChar) {
+  std::vector<char> v(100003);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<char>('a' + i % 26);
+  }
+  auto res_std =
+      std::count_if(v.begin(), v.end(), [](char c) { return c == 'e'; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class CountIfCharAlgorithm> snp(q);
+  auto res_sycl =
+      count_if(snp, v.begin(), v.end(), [](char c) { return c == 'e'; });
+
+  EXPECT_EQ(res_std, res_sycl);
+}
@@ -220,3 +220,42 @@ TEST_F(ExclusiveScanAlgorithm, TestSyclExclusiveScanNonPowerOfTwoRange) {
     EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
   }
 }
+
+// test of an output distinct from the input, used directly by the buffers
+TEST_F(ExclusiveScanAlgorithm, TestSyclExclusiveScanOutOfPlace) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> gold(v);
+  std::vector<int> result(v.size());
+
+  exclusive_scan_gold(gold, 10, [](int a, int b) { return a + b; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ExclusiveScanAlgorithmOOP> snp(q);
+  auto end = exclusive_scan(snp, v.cbegin(), v.cend(), result.begin(), 10,
+                            [](int a, int b) { return a + b; });
+
+  EXPECT_TRUE(end == result.end());
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+// test of an in place scan of a buffer
+TEST_F(ExclusiveScanAlgorithm, TestSyclExclusiveScanBuffer) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> gold(v);
+
+  exclusive_scan_gold(gold, 10, [](int a, int b) { return a + b; });
+
+  {
+    cl::sycl::buffer<int, 1> buf { v.data(),
+                                   cl::sycl::range<1> { v.size() } };
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class ExclusiveScanAlgorithmBuffer> snp(q);
+    exclusive_scan(snp, sycl::helpers::begin(buf), sycl::helpers::end(buf),
+                   sycl::helpers::begin(buf), 10,
+                   [](int a, int b) { return a + b; });
+  }
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
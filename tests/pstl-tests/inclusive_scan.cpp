@@ -244,3 +244,70 @@ TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanNonPowerOfTwoRange) {
     EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
   }
 }
+
+// test of an input spread over many work-groups
+TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanManyWorkGroups) {
+  std::vector<int> v(1 << 22);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<int>(i % 3);
+  }
+  std::vector<int> gold(v);
+
+  inclusive_scan_gold(gold, 5, std::plus<int>());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class InclusiveScanAlgorithmMWG> snp(q);
+
+  inclusive_scan(snp, v.begin(), v.end(), v.begin(),
+                 plus<int>(), 5);
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+// test of a scan between two buffers
+TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanBuffer) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> gold(v);
+  std::vector<int> result(v.size());
+
+  inclusive_scan_gold(gold, 10, std::plus<int>());
+
+  {
+    cl::sycl::buffer<int, 1> in { v.data(), cl::sycl::range<1> { v.size() } };
+    cl::sycl::buffer<int, 1> out { result.data(),
+                                   cl::sycl::range<1> { result.size() } };
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class InclusiveScanAlgorithmBuffer> snp(q);
+    inclusive_scan(snp, sycl::helpers::begin(in), sycl::helpers::end(in),
+                   sycl::helpers::begin(out), plus<int>(), 10);
+  }
+
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+// test of a scan into a shifted, overlapping range of the same buffer
+TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanBufferOverlap) {
+  const size_t size = 1 << 20;
+  const size_t shift = 100;
+  std::vector<int> v(size + shift);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<int>(i % 5);
+  }
+  std::vector<int> gold(v.begin(), v.begin() + size);
+
+  inclusive_scan_gold(gold, 10, std::plus<int>());
+
+  {
+    cl::sycl::buffer<int, 1> buf { v.data(),
+                                   cl::sycl::range<1> { v.size() } };
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class InclusiveScanAlgorithmBufferOverlap>
+        snp(q);
+    inclusive_scan(snp, sycl::helpers::begin(buf),
+                   sycl::helpers::begin(buf) + size,
+                   sycl::helpers::begin(buf) + shift, plus<int>(), 10);
+  }
+
+  EXPECT_TRUE(std::equal(gold.begin(), gold.end(), v.begin() + shift));
+}
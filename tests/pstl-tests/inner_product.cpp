@@ -179,3 +179,16 @@ TEST_F(InnerProductAlgorithm, TestSycl8InnerProduct) {
 
   EXPECT_TRUE( (128*2) == value);
 }
+
+TEST_F(InnerProductAlgorithm, TestSycl9InnerProduct) {
+  std::vector<int> v1(5000, 1);
+  std::vector<int> v2(5000);
+  std::iota(v2.begin(), v2.end(), 0);
+  int result = std::inner_product(v1.begin(), v1.end(), v2.begin(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SYCL9InnerProductAlgorithm> snp(q);
+  int value = inner_product(snp, v1.begin(), v1.end(), v2.begin(), 0);
+
+  EXPECT_EQ(result, value);
+}
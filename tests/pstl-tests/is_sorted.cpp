@@ -0,0 +1,91 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct IsSortedAlgorithm : public testing::Test {};
+
+TEST_F(IsSortedAlgorithm, TestSyclIsSorted) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class IsSortedAlgorithm1> snp(q);
+  EXPECT_TRUE(is_sorted(snp, v.begin(), v.end()));
+
+  v[700] = 0;
+  EXPECT_FALSE(is_sorted(snp, v.begin(), v.end()));
+}
+
+TEST_F(IsSortedAlgorithm, TestSyclIsSortedUntil) {
+  std::vector<float> v(1025);
+  std::iota(v.begin(), v.end(), 0.0f);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class IsSortedUntilAlgorithm1> snp(q);
+  EXPECT_TRUE(is_sorted_until(snp, v.begin(), v.end()) == v.end());
+
+  for (size_t pos : {size_t(1), size_t(500), size_t(1024)}) {
+    std::vector<float> w(v);
+    w[pos] = -1.0f;
+    w[1024 - pos / 2] = -2.0f;
+    auto res = is_sorted_until(snp, w.begin(), w.end());
+    EXPECT_TRUE(res == std::is_sorted_until(w.begin(), w.end()));
+  }
+}
+
+TEST_F(IsSortedAlgorithm, TestSyclIsSortedUntilComp) {
+  std::vector<int> v(333);
+  std::iota(v.begin(), v.end(), 0);
+  std::reverse(v.begin(), v.end());
+  v[200] = 1000;
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class IsSortedUntilAlgorithm2> snp(q);
+  auto res = is_sorted_until(snp, v.begin(), v.end(),
+                             [](int a, int b) { return a > b; });
+  EXPECT_TRUE(res == v.begin() + 200);
+}
+
+TEST_F(IsSortedAlgorithm, TestSyclIsSortedSmallSizes) {
+  std::vector<int> v = {2, 1};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class IsSortedAlgorithm2> snp(q);
+  EXPECT_TRUE(is_sorted(snp, v.begin(), v.begin()));
+  EXPECT_TRUE(is_sorted(snp, v.begin(), v.begin() + 1));
+  EXPECT_FALSE(is_sorted(snp, v.begin(), v.end()));
+}
@@ -0,0 +1,105 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+class MinMaxElementAlgorithm : public testing::Test {
+ public:
+};
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinElement) {
+  std::vector<int> v(2048);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = (i * 37) % 101;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MinElementAlgorithm> snp(q);
+  auto res = min_element(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::min_element(v.begin(), v.end()) == res);
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMaxElement) {
+  std::vector<int> v(2048);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = (i * 37) % 101;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MaxElementAlgorithm> snp(q);
+  auto res = max_element(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::max_element(v.begin(), v.end()) == res);
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinMaxElement) {
+  std::vector<float> v(4096);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<float>((i * 13) % 257);
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MinMaxElementAlgorithm> snp(q);
+  auto res = minmax_element(snp, v.begin(), v.end());
+  auto res_std = std::minmax_element(v.begin(), v.end());
+
+  EXPECT_TRUE(res_std.first == res.first);
+  EXPECT_TRUE(res_std.second == res.second);
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinMaxElementComp) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MinMaxElementCompAlgorithm> snp(q);
+  auto comp = [](int a, int b) { return (a % 10) < (b % 10); };
+  auto res = minmax_element(snp, v.begin(), v.end(), comp);
+  auto res_std = std::minmax_element(v.begin(), v.end(), comp);
+
+  EXPECT_TRUE(res_std.first == res.first);
+  EXPECT_TRUE(res_std.second == res.second);
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinElementEmpty) {
+  std::vector<int> v;
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MinElementEmptyAlgorithm> snp(q);
+
+  EXPECT_TRUE(v.end() == min_element(snp, v.begin(), v.end()));
+}
@@ -0,0 +1,78 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+using sycl::helpers::make_map_reduce;
+
+class MultiReduceAlgorithm : public testing::Test {
+ public:
+};
+
+TEST_F(MultiReduceAlgorithm, TestSyclMultiReduce) {
+  std::vector<int> v(4096);
+  std::iota(v.begin(), v.end(), -1000);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MultiReduceAlgorithm> snp(q);
+  auto res = multi_reduce(
+      snp, v.begin(), v.end(),
+      make_map_reduce(0, [=](int x) { return x; },
+                      [=](int a, int b) { return a + b; }),
+      make_map_reduce(v[0], [=](int x) { return x; },
+                      [=](int a, int b) { return a < b ? a : b; }),
+      make_map_reduce(v[0], [=](int x) { return x; },
+                      [=](int a, int b) { return a < b ? b : a; }),
+      make_map_reduce(0L, [=](int x) { return x < 0 ? 1L : 0L; },
+                      [=](long a, long b) { return a + b; }));
+
+  EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), std::get<0>(res));
+  EXPECT_EQ(-1000, std::get<1>(res));
+  EXPECT_EQ(3095, std::get<2>(res));
+  EXPECT_EQ(1000L, std::get<3>(res));
+}
+
+TEST_F(MultiReduceAlgorithm, TestSyclMultiReduceEmpty) {
+  std::vector<float> v;
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MultiReduceEmptyAlgorithm> snp(q);
+  auto res = multi_reduce(
+      snp, v.begin(), v.end(),
+      make_map_reduce(1.0f, [=](float x) { return x; },
+                      [=](float a, float b) { return a * b; }));
+
+  EXPECT_EQ(1.0f, std::get<0>(res));
+}
@@ -0,0 +1,71 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct NthElementAlgorithm : public testing::Test {};
+
+TEST_F(NthElementAlgorithm, TestSyclNthElement) {
+  std::vector<long> v(1000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100 - 50; });
+  std::vector<long> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class NthElementAlgorithm1> snp(q);
+  for (size_t nth : {size_t(0), size_t(500), size_t(999)}) {
+    nth_element(snp, v.begin(), v.begin() + nth, v.end());
+
+    EXPECT_EQ(v[nth], gold[nth]);
+    EXPECT_TRUE(std::all_of(v.begin(), v.begin() + nth,
+                            [&](long x) { return x <= v[nth]; }));
+    EXPECT_TRUE(std::all_of(v.begin() + nth, v.end(),
+                            [&](long x) { return x >= v[nth]; }));
+  }
+}
+
+TEST_F(NthElementAlgorithm, TestSyclNthElementComp) {
+  std::vector<int> v(333);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 1000; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end(), [](int a, int b) { return a > b; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class NthElementAlgorithm2> snp(q);
+  nth_element(snp, v.begin(), v.begin() + 100, v.end(),
+              [](int a, int b) { return a > b; });
+
+  EXPECT_EQ(v[100], gold[100]);
+}
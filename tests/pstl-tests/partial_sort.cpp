@@ -0,0 +1,100 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct PartialSortAlgorithm : public testing::Test {};
+
+TEST_F(PartialSortAlgorithm, TestSyclPartialSort) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 200 - 100; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm1> snp(q);
+  partial_sort(snp, v.begin(), v.begin() + 37, v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.begin() + 37, gold.begin()));
+  std::sort(v.begin() + 37, v.end());
+  EXPECT_TRUE(std::equal(v.begin() + 37, v.end(), gold.begin() + 37));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclPartialSortComp) {
+  std::vector<int> v(777);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 1000; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end(), [](int a, int b) { return a > b; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm2> snp(q);
+  partial_sort(snp, v.begin(), v.begin() + 10, v.end(),
+               [](int a, int b) { return a > b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.begin() + 10, gold.begin()));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclPartialSortCopy) {
+  std::vector<float> v(1000);
+  std::generate(v.begin(), v.end(),
+                []() { return static_cast<float>(std::rand() % 500) - 250.5f; });
+  std::vector<float> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  std::vector<float> top(16);
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm3> snp(q);
+  auto end = partial_sort_copy(snp, v.begin(), v.end(), top.begin(), top.end());
+
+  EXPECT_TRUE(end == top.end());
+  EXPECT_TRUE(std::equal(top.begin(), top.end(), gold.begin()));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclPartialSortCopyLargerOutput) {
+  std::vector<int> v(100);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 50; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end(), [](int a, int b) { return a > b; });
+
+  std::vector<int> out(150, -1);
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm4> snp(q);
+  auto end = partial_sort_copy(snp, v.begin(), v.end(), out.begin(), out.end(),
+                               [](int a, int b) { return a > b; });
+
+  EXPECT_TRUE(end == out.begin() + v.size());
+  EXPECT_TRUE(std::equal(out.begin(), end, gold.begin()));
+  EXPECT_EQ(out[v.size()], -1);
+}
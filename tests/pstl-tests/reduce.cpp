@@ -138,3 +138,97 @@ TEST_F(ReduceAlgorithm, TestSyclReduce7) {
 
   EXPECT_EQ(resstd, ressycl);
 }
+
+TEST_F(ReduceAlgorithm, TestSyclReduce8) {
+  std::vector<int> v(8192);
+  std::iota(v.begin(), v.end(), 0);
+
+  int resstd = std::accumulate(v.begin(), v.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class Reduce8Algorithm> snp(q);
+  int ressycl = reduce(snp, v.begin(), v.end());
+
+  EXPECT_EQ(resstd, ressycl);
+}
+
+TEST_F(ReduceAlgorithm, TestSyclReduceAsync) {
+  std::vector<int> v1(1024);
+  std::vector<float> v2(4096);
+  std::iota(v1.begin(), v1.end(), 0);
+  std::iota(v2.begin(), v2.end(), 0.0f);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceAsync1Algorithm> snp1(q);
+  sycl::sycl_execution_policy<class ReduceAsync2Algorithm> snp2(q);
+  auto f1 = reduce_async(snp1, v1.begin(), v1.end(), 10);
+  auto f2 = reduce_async(snp2, v2.begin(), v2.end(), 0.0f,
+                         [=](float a, float b) { return std::max(a, b); });
+
+  EXPECT_EQ(std::accumulate(v1.begin(), v1.end(), 10), f1.get());
+  EXPECT_EQ(4095.0f, f2.get());
+}
+
+// reduce_async only waits for its kernels when the result is read
+TEST_F(ReduceAlgorithm, TestSyclReduceAsyncDoesNotWait) {
+  std::vector<int> v(1024);
+  std::iota(v.begin(), v.end(), 0);
+  int gold = std::accumulate(v.begin(), v.end(), 10);
+  cl::sycl::buffer<int, 1> b{v.data(), cl::sycl::range<1>(v.size())};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceAsyncDoesNotWaitAlgorithm> snp(q);
+  sycl::helpers::sycl_future<int> f(0);
+  {
+    // the kernels cannot read the input while this accessor is alive, so
+    // reduce_async would never return if it waited for them
+    auto h = b.get_access<cl::sycl::access::mode::read_write>();
+    f = reduce_async(snp, sycl::helpers::begin(b), sycl::helpers::end(b), 10,
+                     [](int a, int b) { return a + b; });
+  }
+  f.wait();
+  EXPECT_EQ(gold, f.get());
+}
+
+TEST_F(ReduceAlgorithm, TestSyclReduceCompensated) {
+  std::vector<float> v(1 << 22);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = 0.1f + static_cast<float>(i % 7) * 1e-3f;
+  }
+  double resstd = 0;
+  for (float x : v) {
+    resstd += x;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceCompensatedAlgorithm> snp(q);
+  float ressycl = reduce(snp, v.begin(), v.end(), 0.0f,
+                         sycl::helpers::compensated_plus<float>());
+
+  EXPECT_NEAR(resstd, ressycl, resstd * 1e-6);
+}
+
+TEST_F(ReduceAlgorithm, TestSyclReduceToBuffer) {
+  std::vector<int> v1(1024);
+  std::vector<int> v2(100, 2);
+  std::iota(v1.begin(), v1.end(), 0);
+  cl::sycl::buffer<int, 1> out{cl::sycl::range<1>(3)};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceToBuffer1Algorithm> snp1(q);
+  sycl::sycl_execution_policy<class ReduceToBuffer2Algorithm> snp2(q);
+  sycl::sycl_execution_policy<class ReduceToBuffer3Algorithm> snp3(q);
+  auto plus = [](int a, int b) { return a + b; };
+  auto h1 = reduce(snp1, v1.begin(), v1.end(), 10, plus, out, 0);
+  auto h2 = reduce(snp2, v2.begin(), v2.end(), 0, plus, out, 1);
+  auto h3 = reduce(snp3, v2.begin(), v2.begin(), 7, plus,
+                   sycl::helpers::begin(out) + 2);
+  h1.wait();
+  h2.wait();
+  h3.wait();
+
+  auto res = out.get_access<cl::sycl::access::mode::read>();
+  EXPECT_EQ(std::accumulate(v1.begin(), v1.end(), 10), res[0]);
+  EXPECT_EQ(200, res[1]);
+  EXPECT_EQ(7, res[2]);
+}
@@ -0,0 +1,87 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+class ReduceByKeyAlgorithm : public testing::Test {
+ public:
+};
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclReduceByKey) {
+  std::vector<int> keys = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+  std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<int> keys_res = {1, 2, 3, 1, 4};
+  std::vector<int> values_res = {3, 3, 15, 7, 17};
+  std::vector<int> keys_out(keys.size());
+  std::vector<int> values_out(values.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceByKeyAlgorithm> snp(q);
+  auto ends = reduce_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                            keys_out.begin(), values_out.begin());
+
+  EXPECT_EQ(keys_res.size(), std::distance(keys_out.begin(), ends.first));
+  EXPECT_EQ(values_res.size(), std::distance(values_out.begin(), ends.second));
+  EXPECT_TRUE(std::equal(keys_res.begin(), keys_res.end(), keys_out.begin()));
+  EXPECT_TRUE(
+      std::equal(values_res.begin(), values_res.end(), values_out.begin()));
+}
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclReduceByKeyLarge) {
+  size_t size = 100000;
+  std::vector<int> keys(size);
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; i++) {
+    keys[i] = static_cast<int>(i / 7);
+    values[i] = static_cast<float>(i % 7);
+  }
+  std::vector<int> keys_out(size);
+  std::vector<float> values_out(size);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceByKeyLargeAlgorithm> snp(q);
+  auto ends = reduce_by_key(
+      snp, keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+      values_out.begin(), [](int a, int b) { return a == b; },
+      [](float a, float b) { return std::max(a, b); });
+
+  size_t nb_segments = (size + 6) / 7;
+  EXPECT_EQ(nb_segments, std::distance(keys_out.begin(), ends.first));
+  for (size_t i = 0; i < nb_segments; i++) {
+    EXPECT_EQ(static_cast<int>(i), keys_out[i]);
+    EXPECT_EQ(static_cast<float>(std::min<size_t>(6, size - 1 - 7 * i)),
+              values_out[i]);
+  }
+}
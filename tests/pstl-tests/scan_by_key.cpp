@@ -0,0 +1,90 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+class ScanByKeyAlgorithm : public testing::Test {
+ public:
+};
+
+TEST_F(ScanByKeyAlgorithm, TestSyclInclusiveScanByKey) {
+  std::vector<int> keys = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+  std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<int> gold = {1, 3, 3, 4, 9, 15, 7, 8, 17};
+  std::vector<int> result(values.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class InclusiveScanByKeyAlgorithm> snp(q);
+  auto end = inclusive_scan_by_key(snp, keys.begin(), keys.end(),
+                                   values.begin(), result.begin());
+
+  EXPECT_TRUE(end == result.end());
+  EXPECT_TRUE(std::equal(gold.begin(), gold.end(), result.begin()));
+}
+
+TEST_F(ScanByKeyAlgorithm, TestSyclExclusiveScanByKey) {
+  std::vector<int> keys = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+  std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<int> gold = {10, 11, 10, 10, 14, 19, 10, 10, 18};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ExclusiveScanByKeyAlgorithm> snp(q);
+  exclusive_scan_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                        values.begin(), 10);
+
+  EXPECT_TRUE(std::equal(gold.begin(), gold.end(), values.begin()));
+}
+
+TEST_F(ScanByKeyAlgorithm, TestSyclInclusiveScanByKeyLarge) {
+  size_t size = 100000;
+  std::vector<int> keys(size);
+  std::vector<float> values(size);
+  std::vector<float> gold(size);
+  for (size_t i = 0; i < size; i++) {
+    keys[i] = static_cast<int>(i / 7);
+    values[i] = static_cast<float>(i % 7);
+    gold[i] = static_cast<float>(i % 7);
+  }
+  std::vector<float> result(size);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class InclusiveScanByKeyLargeAlgorithm> snp(q);
+  inclusive_scan_by_key(
+      snp, keys.begin(), keys.end(), values.begin(), result.begin(),
+      [](int a, int b) { return a == b; },
+      [](float a, float b) { return std::max(a, b); });
+
+  EXPECT_TRUE(std::equal(gold.begin(), gold.end(), result.begin()));
+}
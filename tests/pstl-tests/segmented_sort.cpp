@@ -0,0 +1,75 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct SegmentedSortAlgorithm : public testing::Test {};
+
+TEST_F(SegmentedSortAlgorithm, TestSyclSegmentedSort) {
+  const size_t segmentSize = 300;
+  // the last segment is shorter than the others
+  std::vector<int> v(segmentSize * 7 + 123);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 1000; });
+  std::vector<int> gold(v);
+  for (size_t i = 0; i < gold.size(); i += segmentSize) {
+    std::sort(gold.begin() + i,
+              gold.begin() + std::min(i + segmentSize, gold.size()));
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SegmentedSortAlgorithm1> snp(q);
+  segmented_sort(snp, v.begin(), v.end(), segmentSize);
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(SegmentedSortAlgorithm, TestSyclSegmentedSortComp) {
+  const size_t segmentSize = 64;
+  std::vector<float> v(segmentSize * 20);
+  std::generate(v.begin(), v.end(),
+                []() { return static_cast<float>(std::rand() % 1000); });
+  std::vector<float> gold(v);
+  for (size_t i = 0; i < gold.size(); i += segmentSize) {
+    std::sort(gold.begin() + i, gold.begin() + i + segmentSize,
+              [](float a, float b) { return a > b; });
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SegmentedSortAlgorithm2> snp(q);
+  segmented_sort(snp, v.begin(), v.end(), segmentSize,
+                 [](float a, float b) { return a > b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
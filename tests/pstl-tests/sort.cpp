@@ -28,9 +28,11 @@
 
 #include <vector>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 
 #include <sycl/execution_policy>
+#include <sycl/heterogeneous_execution_policy.hpp>
 #include <experimental/algorithm>
 
 using namespace std::experimental::parallel;
@@ -97,3 +99,184 @@ TEST_F(SortAlgorithm, TestSycl3Sort) {
 
   EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
 }
+
+TEST_F(SortAlgorithm, TestSyclRadixSortNonPowerOfTwo) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() - RAND_MAX / 2; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class RadixSortAlgorithm1> snp(q);
+  // The radix sort is triggered by arithmetic types with the default
+  // comparison, whatever the vector size
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclRadixSortFloat) {
+  std::vector<float> v(777);
+  std::generate(v.begin(), v.end(), []() {
+    return (static_cast<float>(std::rand()) / RAND_MAX - 0.5f) * 1000.0f;
+  });
+  v[0] = -0.0f;
+  v[1] = 0.0f;
+  std::vector<float> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class RadixSortAlgorithm2> snp(q);
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclRadixSortUnsigned64) {
+  std::vector<unsigned long long> v(513);
+  std::generate(v.begin(), v.end(), []() {
+    return (static_cast<unsigned long long>(std::rand()) << 33) ^ std::rand();
+  });
+  std::vector<unsigned long long> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class RadixSortAlgorithm3> snp(q);
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclBitonicSortCompNonPowerOfTwo) {
+  std::vector<int> v(1003);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end(), [](int a, int b) { return a > b; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class BitonicSortAlgorithm1> snp(q);
+  // The bitonic sort virtually pads non power of two sizes
+  sort(snp, v.begin(), v.end(), [=](int a, int b) { return a < b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+struct sort_pair {
+  int key;
+  int value;
+
+  bool operator>(const sort_pair& other) const { return key > other.key; }
+};
+
+TEST_F(SortAlgorithm, TestSyclBitonicSortNonPowerOfTwo) {
+  std::vector<sort_pair> v(600);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = sort_pair{std::rand() % 1000, static_cast<int>(i)};
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class BitonicSortAlgorithm2> snp(q);
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::is_sorted(v.begin(), v.end(),
+                             [](const sort_pair& a, const sort_pair& b) {
+                               return b > a;
+                             }));
+}
+
+TEST_F(SortAlgorithm, TestSyclBitonicSortSmallSizes) {
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class BitonicSortAlgorithm3> snp(q);
+  for (size_t n = 0; n < 40; n++) {
+    std::vector<int> v(n);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 10; });
+    std::vector<int> gold(v);
+    std::sort(gold.begin(), gold.end());
+
+    sort(snp, v.begin(), v.end(), [=](int a, int b) { return a >= b; });
+
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+  }
+}
+
+TEST_F(SortAlgorithm, TestSyclSortByKey) {
+  std::vector<int> keys(1000);
+  std::vector<int> values(keys.size());
+  std::generate(keys.begin(), keys.end(), []() { return std::rand() % 50; });
+  std::iota(values.begin(), values.end(), 0);
+
+  std::vector<std::pair<int, int>> gold(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    gold[i] = std::make_pair(keys[i], values[i]);
+  }
+  // values are increasing, so a stable sort also sorts the pairs
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm1> snp(q);
+  sort_by_key(snp, keys.begin(), keys.end(), values.begin());
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(keys[i], gold[i].first);
+    EXPECT_EQ(values[i], gold[i].second);
+  }
+}
+
+TEST_F(SortAlgorithm, TestSyclSortByKeyComp) {
+  std::vector<float> keys(777);
+  std::vector<int> values(keys.size());
+  std::generate(keys.begin(), keys.end(),
+                []() { return static_cast<float>(std::rand() % 100); });
+  for (size_t i = 0; i < keys.size(); i++) {
+    values[i] = static_cast<int>(keys[i]) * 2;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm2> snp(q);
+  sort_by_key(snp, keys.begin(), keys.end(), values.begin(),
+              [](float a, float b) { return a > b; });
+
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(),
+                             [](float a, float b) { return a > b; }));
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_EQ(values[i], static_cast<int>(keys[i]) * 2);
+  }
+}
+
+TEST_F(SortAlgorithm, TestSyclHeterogeneousSort) {
+  std::vector<int> v(1500);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 1000 - 500; });
+  std::vector<int> gold(v);
+  std::sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q1;
+  cl::sycl::queue q2;
+  for (float ratio : {0.0f, 0.3f, 0.5f, 1.0f}) {
+    std::vector<int> w(v);
+    sycl::sycl_heterogeneous_execution_policy<class HeterogeneousSort1> snp(
+        q1, q2, ratio);
+    sort(snp, w.begin(), w.end());
+
+    EXPECT_TRUE(std::equal(w.begin(), w.end(), gold.begin()));
+  }
+}
+
+TEST_F(SortAlgorithm, TestSyclHeterogeneousSortComp) {
+  std::vector<sort_pair> v(999);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i].key = std::rand() % 100;
+    v[i].value = static_cast<int>(i);
+  }
+
+  cl::sycl::queue q1;
+  cl::sycl::queue q2;
+  sycl::sycl_heterogeneous_execution_policy<class HeterogeneousSort2> snp(
+      q1, q2, 0.7f);
+  sort(snp, v.begin(), v.end(),
+       [](sort_pair a, sort_pair b) { return a.key < b.key; });
+
+  EXPECT_TRUE(std::is_sorted(
+      v.begin(), v.end(),
+      [](sort_pair a, sort_pair b) { return a.key > b.key; }));
+}
@@ -0,0 +1,125 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct StableSortAlgorithm : public testing::Test {};
+
+struct event {
+  int time;
+  int id;
+
+  bool operator<(const event& other) const { return time < other.time; }
+  bool operator==(const event& other) const {
+    return time == other.time && id == other.id;
+  }
+};
+
+TEST_F(StableSortAlgorithm, TestSyclStableSort) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 1000 - 500; });
+  std::vector<int> gold(v);
+  std::stable_sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class StableSortAlgorithm1> snp(q);
+  stable_sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(StableSortAlgorithm, TestSyclStableSortDefault) {
+  std::vector<event> v(1000);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = event{std::rand() % 30, static_cast<int>(i)};
+  }
+  std::vector<event> gold(v);
+  std::stable_sort(gold.begin(), gold.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class StableSortAlgorithm2> snp(q);
+  stable_sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+TEST_F(StableSortAlgorithm, TestSyclStableSortComp) {
+  std::vector<event> v(1025);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = event{std::rand() % 30, static_cast<int>(i)};
+  }
+  auto comp = [](const event& a, const event& b) { return a.time > b.time; };
+  std::vector<event> gold(v);
+  std::stable_sort(gold.begin(), gold.end(), comp);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class StableSortAlgorithm3> snp(q);
+  stable_sort(snp, v.begin(), v.end(), comp);
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+struct StableSortLargeRecord {
+  int time;
+  int payload[4095];
+};
+
+TEST_F(StableSortAlgorithm, TestSyclStableSortLarge) {
+  typedef StableSortLargeRecord record;
+  cl::sycl::queue q;
+  auto local_mem_size =
+      q.get_device().get_info<cl::sycl::info::device::local_mem_size>();
+  if (local_mem_size >= 16 * sizeof(record)) {
+    return;
+  }
+
+  std::vector<record> v(67);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = record();
+    v[i].time = std::rand() % 10;
+    v[i].payload[0] = static_cast<int>(i);
+  }
+  auto comp = [](const record& a, const record& b) { return a.time < b.time; };
+  std::vector<record> gold(v);
+  std::stable_sort(gold.begin(), gold.end(), comp);
+
+  sycl::sycl_execution_policy<class StableSortAlgorithmLarge> snp(q);
+  stable_sort(snp, v.begin(), v.end(), comp);
+
+  for (size_t i = 0; i < v.size(); i++) {
+    EXPECT_EQ(gold[i].time, v[i].time);
+    EXPECT_EQ(gold[i].payload[0], v[i].payload[0]);
+  }
+}
@@ -0,0 +1,73 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct TransformExclusiveScanAlgorithm : public testing::Test {};
+
+TEST_F(TransformExclusiveScanAlgorithm, TestSyclTransformExclusiveScan) {
+  std::vector<int> v = {5, 1, 6, 2, 6, 2, 5, 7};
+  std::vector<int> result(v.size());
+  std::vector<int> gold = {10, 35, 36, 72, 76, 112, 116, 141};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformExclusiveScanAlgorithm> snp(q);
+  auto end = transform_exclusive_scan(snp, v.begin(), v.end(), result.begin(),
+                                      10, [](int a, int b) { return a + b; },
+                                      [](int x) { return x * x; });
+
+  EXPECT_TRUE(end == result.end());
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+TEST_F(TransformExclusiveScanAlgorithm, TestSyclTransformExclusiveScanInPlace) {
+  std::vector<int> v(1 << 16);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> gold(v.size());
+
+  int acc = 0;
+  for (size_t i = 0; i < v.size(); i++) {
+    gold[i] = acc;
+    acc += v[i] % 5;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformExclusiveScanAlgorithmIP> snp(q);
+  transform_exclusive_scan(snp, v.begin(), v.end(), v.begin(), 0,
+                           [](int a, int b) { return a + b; },
+                           [](int x) { return x % 5; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
@@ -0,0 +1,157 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct TransformInclusiveScanAlgorithm : public testing::Test {};
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScan) {
+  std::vector<int> v = {5, 1, 6, 2, 6, 2, 5, 7};
+  std::vector<int> result(v.size());
+  std::vector<int> gold = {25, 26, 62, 66, 102, 106, 131, 180};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithm> snp(q);
+  transform_inclusive_scan(snp, v.begin(), v.end(), result.begin(),
+                           [](int a, int b) { return a + b; },
+                           [](int x) { return x * x; });
+
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanInit) {
+  std::vector<int> v(1 << 16);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<float> result(v.size());
+  std::vector<float> gold(v.size());
+
+  float acc = 0.5f;
+  for (size_t i = 0; i < v.size(); i++) {
+    acc += (v[i] % 7) * 0.5f;
+    gold[i] = acc;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithmInit> snp(q);
+  transform_inclusive_scan(snp, v.begin(), v.end(), result.begin(),
+                           [](float a, float b) { return a + b; },
+                           [](int x) { return (x % 7) * 0.5f; }, 0.5f);
+
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+// without init the first element seeds the scan, 0 is not an identity here
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanMult) {
+  std::vector<int> v = {2, 1, 3, 1, 2, 1, 1, 2};
+  std::vector<int> result(v.size());
+  std::vector<int> gold = {3, 6, 24, 48, 144, 288, 576, 1728};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithmMult> snp(
+      q);
+  transform_inclusive_scan(snp, v.begin(), v.end(), result.begin(),
+                           [](int a, int b) { return a * b; },
+                           [](int x) { return x + 1; });
+
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), gold.begin()));
+}
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanMax) {
+  std::vector<int> v(1 << 16);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<int>((i * 7919) % 1000);
+  }
+  std::vector<int> gold(v.size());
+  int acc = -v[0] - 1;
+  for (size_t i = 0; i < v.size(); i++) {
+    acc = std::max(acc, -v[i] - 1);
+    gold[i] = acc;
+  }
+
+  {
+    cl::sycl::buffer<int, 1> buf { v.data(),
+                                   cl::sycl::range<1> { v.size() } };
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithmMax> snp(
+        q);
+    transform_inclusive_scan(snp, sycl::helpers::begin(buf),
+                             sycl::helpers::end(buf),
+                             sycl::helpers::begin(buf),
+                             [](int a, int b) { return std::max(a, b); },
+                             [](int x) { return -x - 1; });
+  }
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
+
+// an element larger than the local memory cannot be scanned by work-groups
+struct TransformInclusiveScanLargeRecord {
+  int key;
+  int payload[32767];
+};
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanLarge) {
+  typedef TransformInclusiveScanLargeRecord record;
+  cl::sycl::queue q;
+  auto local_mem_size =
+      q.get_device().get_info<cl::sycl::info::device::local_mem_size>();
+  if (local_mem_size >= sizeof(record)) {
+    return;
+  }
+
+  std::vector<int> v = {5, 1, 6, 2, 6, 2, 5, 7};
+  std::vector<record> result(v.size());
+  std::vector<int> gold = {7, 9, 16, 19, 26, 29, 35, 43};
+
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithmLarge> snp(
+      q);
+  record init = record();
+  init.key = 1;
+  transform_inclusive_scan(snp, v.begin(), v.end(), result.begin(),
+                           [](record a, record b) {
+                             a.key += b.key;
+                             return a;
+                           },
+                           [](int x) {
+                             record r = record();
+                             r.key = x + 1;
+                             return r;
+                           },
+                           init);
+
+  for (size_t i = 0; i < v.size(); i++) {
+    EXPECT_EQ(gold[i], result[i].key);
+  }
+}
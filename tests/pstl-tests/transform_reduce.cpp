@@ -66,3 +66,35 @@ TEST_F(TransformReduceAlgorithm, TestSyclTransformReduce2) {
 
   EXPECT_TRUE( (2*128) == ressycl);
 }
+
+TEST_F(TransformReduceAlgorithm, TestSyclTransformReduceAsync) {
+  std::vector<int> v(512, 3);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformReduceAsyncAlgorithm> snp(q);
+  auto result = transform_reduce_async(snp, v.begin(), v.end(),
+                                       [=](int val) { return val * 2; }, 1,
+                                       [=](int v1, int v2) { return v1 + v2; });
+  result.wait();
+
+  EXPECT_EQ(1 + 512 * 6, result.get());
+}
+
+TEST_F(TransformReduceAlgorithm, TestSyclTransformReduceCompensated) {
+  std::vector<float> v(1 << 22);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = static_cast<float>(i % 13) * 1e-2f;
+  }
+  double resstd = 1;
+  for (float x : v) {
+    resstd += x * x;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformReduceCompensatedAlgorithm> snp(q);
+  float ressycl = transform_reduce(snp, v.begin(), v.end(),
+                                   [=](float x) { return x * x; }, 1.0f,
+                                   sycl::helpers::compensated_plus<float>());
+
+  EXPECT_NEAR(resstd, ressycl, resstd * 1e-6);
+}